@@ -1,5 +1,6 @@
 #include "notepad.hpp"
 
+#include <exception>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
@@ -8,6 +9,7 @@
 
 #include <termox/painter/color.hpp>
 #include <termox/painter/trait.hpp>
+#include <termox/system/async.hpp>
 #include <termox/system/system.hpp>
 #include <termox/widget/border.hpp>
 #include <termox/widget/pipe.hpp>
@@ -48,13 +50,14 @@ void Notepad::initialize()
 {
     // Signals
     save_area.load_request.connect([this](std::string filename) {
-        try {
-            txt_trait.textbox.set_contents(::read_file(filename));
-            status_bar.success(filename + " Loaded");
-        }
-        catch (std::runtime_error const& e) {
-            status_bar.fail(e.what());
-        }
+        ox::async([filename] { return ::read_file(filename); })
+            .then_on_main(
+                this->lifetime,
+                [this, filename](std::string contents) {
+                    txt_trait.textbox.set_contents(std::move(contents));
+                    status_bar.success(filename + " Loaded");
+                },
+                [this](std::exception const& e) { status_bar.fail(e.what()); });
     });
 
     save_area.save_request.connect([this](std::string filename) {
@@ -0,0 +1,167 @@
+#ifndef TERMOX_COMMON_INPLACE_FUNCTION_HPP
+#define TERMOX_COMMON_INPLACE_FUNCTION_HPP
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ox {
+
+template <typename Signature, std::size_t Capacity>
+class Inplace_function;
+
+/// Callable wrapper that stores small callables in place.
+/** Callables up to \p Capacity bytes are stored within the object itself,
+ *  larger callables fall back to a single heap allocation, so any size of
+ *  callable can be stored. As with std::function, callables must be copy
+ *  constructible and copying the wrapper copies the callable. The object is
+ *  Capacity plus one pointer in size. */
+template <typename R, typename... Args, std::size_t Capacity>
+class Inplace_function<R(Args...), Capacity> {
+   public:
+    /// Construct an empty function, calling it is undefined.
+    Inplace_function() = default;
+
+    Inplace_function(std::nullptr_t) {}
+
+    template <typename F,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::decay_t<F>, Inplace_function> &&
+                  std::is_copy_constructible_v<std::decay_t<F>> &&
+                  std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+    Inplace_function(F&& f)
+    {
+        using Callable_t = std::decay_t<F>;
+        if constexpr (is_stored_inline<Callable_t>) {
+            ::new (static_cast<void*>(&storage_))
+                Callable_t(std::forward<F>(f));
+            ops_ = &inline_operations<Callable_t>;
+        }
+        else {
+            ::new (static_cast<void*>(&storage_))
+                Callable_t*(new Callable_t(std::forward<F>(f)));
+            ops_ = &heap_operations<Callable_t>;
+        }
+    }
+
+    Inplace_function(Inplace_function const& other)
+    {
+        if (other.ops_ != nullptr) {
+            other.ops_->copy(&other.storage_, &storage_);
+            ops_ = other.ops_;
+        }
+    }
+
+    auto operator=(Inplace_function const& other) -> Inplace_function&
+    {
+        if (this != &other)
+            *this = Inplace_function{other};
+        return *this;
+    }
+
+    Inplace_function(Inplace_function&& other) noexcept : ops_{other.ops_}
+    {
+        if (ops_ != nullptr) {
+            ops_->move(&other.storage_, &storage_);
+            other.ops_ = nullptr;
+        }
+    }
+
+    auto operator=(Inplace_function&& other) noexcept -> Inplace_function&
+    {
+        if (this != &other) {
+            this->reset();
+            if (other.ops_ != nullptr) {
+                other.ops_->move(&other.storage_, &storage_);
+                ops_       = other.ops_;
+                other.ops_ = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    ~Inplace_function() { this->reset(); }
+
+   public:
+    /// Call the stored callable with \p args.
+    auto operator()(Args... args) const -> R
+    {
+        return ops_->invoke(&storage_, std::forward<Args>(args)...);
+    }
+
+    /// Return true if a callable is stored.
+    explicit operator bool() const { return ops_ != nullptr; }
+
+    friend auto operator==(Inplace_function const& f, std::nullptr_t) -> bool
+    {
+        return f.ops_ == nullptr;
+    }
+
+    friend auto operator!=(Inplace_function const& f, std::nullptr_t) -> bool
+    {
+        return f.ops_ != nullptr;
+    }
+
+   private:
+    using Storage_t =
+        std::aligned_storage_t<(Capacity < sizeof(void*) ? sizeof(void*)
+                                                         : Capacity),
+                               alignof(void*)>;
+
+    struct Operations {
+        R (*invoke)(void const*, Args&&...);
+        /// Copy construct into \p to, may throw.
+        void (*copy)(void const* from, void* to);
+        /// Move construct into \p to and destroy \p from.
+        void (*move)(void* from, void* to) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+
+    template <typename F>
+    static constexpr bool is_stored_inline =
+        sizeof(F) <= sizeof(Storage_t) && alignof(F) <= alignof(Storage_t) &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F>
+    static constexpr auto inline_operations = Operations{
+        [](void const* s, Args&&... args) -> R {
+            return (*static_cast<F*>(const_cast<void*>(s)))(
+                std::forward<Args>(args)...);
+        },
+        [](void const* from, void* to) {
+            ::new (to) F(*static_cast<F const*>(from));
+        },
+        [](void* from, void* to) noexcept {
+            ::new (to) F(std::move(*static_cast<F*>(from)));
+            static_cast<F*>(from)->~F();
+        },
+        [](void* s) noexcept { static_cast<F*>(s)->~F(); }};
+
+    template <typename F>
+    static constexpr auto heap_operations = Operations{
+        [](void const* s, Args&&... args) -> R {
+            return (**static_cast<F* const*>(s))(std::forward<Args>(args)...);
+        },
+        [](void const* from, void* to) {
+            ::new (to) F*(new F(**static_cast<F* const*>(from)));
+        },
+        [](void* from, void* to) noexcept {
+            ::new (to) F*(*static_cast<F**>(from));
+        },
+        [](void* s) noexcept { delete *static_cast<F**>(s); }};
+
+    Operations const* ops_ = nullptr;
+    Storage_t storage_;
+
+   private:
+    void reset()
+    {
+        if (ops_ != nullptr) {
+            ops_->destroy(&storage_);
+            ops_ = nullptr;
+        }
+    }
+};
+
+}  // namespace ox
+#endif  // TERMOX_COMMON_INPLACE_FUNCTION_HPP
@@ -0,0 +1,172 @@
+#ifndef TERMOX_COMMON_MPSC_QUEUE_HPP
+#define TERMOX_COMMON_MPSC_QUEUE_HPP
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace ox {
+
+/// Lock-free multi-producer, single-consumer queue.
+/** Producers push onto an intrusive list with a single compare-exchange, they
+ *  never contend with the consumer for a lock. The consumer detaches the
+ *  entire list as one segment with a single exchange and drains it in push
+ *  order. Anything pushed while a segment is being drained starts the next
+ *  segment. Nodes are recycled through a lock-free pool of \p Pool_size
+ *  nodes, so a queue that never holds more than that does not allocate. */
+template <typename T, std::size_t Pool_size = 256>
+class MPSC_queue {
+   public:
+    MPSC_queue()
+    {
+        for (auto i = 0uL; i < Pool_size; ++i)
+            slots_[i].next_free.store(i + 1, std::memory_order_relaxed);
+        free_head_.store(0u, std::memory_order_release);
+    }
+
+    MPSC_queue(MPSC_queue const&) = delete;
+    MPSC_queue(MPSC_queue&&)      = delete;
+    auto operator=(MPSC_queue const&) -> MPSC_queue& = delete;
+    auto operator=(MPSC_queue&&) -> MPSC_queue& = delete;
+
+    ~MPSC_queue() { this->release_segment(head_.exchange(nullptr)); }
+
+   public:
+    /// Append \p value to the queue. Safe to call from any thread.
+    void push(T value)
+    {
+        auto* const node = this->acquire_node(std::move(value));
+        node->next       = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(node->next, node,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {}
+    }
+
+    /// Detach the current segment and pass each element to \p f, in order.
+    /** Only a single consumer thread may call this. Elements pushed by \p f
+     *  are not visited, they are left in the queue for the next call. Returns
+     *  the number of elements visited. */
+    template <typename F>
+    auto consume_segment(F&& f) -> std::size_t
+    {
+        auto* node = reverse(head_.exchange(nullptr, std::memory_order_acquire));
+        auto count = 0uL;
+        while (node != nullptr) {
+            auto* const next = node->next;
+            auto value       = std::move(node->value);
+            this->release_node(node);
+            node = next;
+            try {
+                f(std::move(value));
+            }
+            catch (...) {
+                this->release_segment(node);
+                throw;
+            }
+            ++count;
+        }
+        return count;
+    }
+
+    /// Return true if nothing is waiting in the queue.
+    /** Only a snapshot, producers may push at any time. */
+    auto empty() const -> bool
+    {
+        return head_.load(std::memory_order_acquire) == nullptr;
+    }
+
+   private:
+    struct Node {
+        T value;
+        Node* next;
+    };
+
+    /// Storage for a pooled Node, storage must be the first member.
+    struct Slot {
+        alignas(Node) std::byte storage[sizeof(Node)];
+        std::atomic<std::uint32_t> next_free;
+    };
+
+    /// Newest element, each Node points to the element pushed before it.
+    std::atomic<Node*> head_{nullptr};
+
+    std::array<Slot, Pool_size> slots_;
+
+    // Index of the first free Slot in the low 32 bits, Pool_size if none. The
+    // high 32 bits count pool operations, so a stale compare-exchange fails.
+    std::atomic<std::uint64_t> free_head_{0u};
+
+   private:
+    /// Reverse a detached segment from newest-first into push order.
+    static auto reverse(Node* node) -> Node*
+    {
+        auto* previous = static_cast<Node*>(nullptr);
+        while (node != nullptr) {
+            auto* const next = node->next;
+            node->next       = previous;
+            previous         = node;
+            node             = next;
+        }
+        return previous;
+    }
+
+    /// Construct a Node from the pool, or the heap if the pool is empty.
+    auto acquire_node(T value) -> Node*
+    {
+        auto head = free_head_.load(std::memory_order_acquire);
+        while (true) {
+            auto const index = static_cast<std::uint32_t>(head);
+            if (index == Pool_size)
+                return new Node{std::move(value), nullptr};
+            auto const next =
+                slots_[index].next_free.load(std::memory_order_relaxed);
+            if (free_head_.compare_exchange_weak(head, tagged(head, next),
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_acquire)) {
+                return ::new (slots_[index].storage)
+                    Node{std::move(value), nullptr};
+            }
+        }
+    }
+
+    /// Destroy \p node and return it to wherever it was acquired from.
+    void release_node(Node* node)
+    {
+        auto const less         = std::less<void const*>{};
+        auto const* const first = static_cast<void const*>(slots_.data());
+        auto const* const last =
+            static_cast<void const*>(slots_.data() + Pool_size);
+        if (less(node, first) || !less(node, last)) {
+            delete node;
+            return;
+        }
+        node->~Node();
+        auto const index = static_cast<std::uint32_t>(
+            reinterpret_cast<Slot*>(node) - slots_.data());
+        auto head = free_head_.load(std::memory_order_relaxed);
+        do {
+            slots_[index].next_free.store(static_cast<std::uint32_t>(head),
+                                          std::memory_order_relaxed);
+        } while (!free_head_.compare_exchange_weak(head, tagged(head, index),
+                                                   std::memory_order_release,
+                                                   std::memory_order_relaxed));
+    }
+
+    void release_segment(Node* node)
+    {
+        while (node != nullptr)
+            this->release_node(std::exchange(node, node->next));
+    }
+
+    /// Return a new free list head pointing at \p index.
+    static auto tagged(std::uint64_t head, std::uint32_t index) -> std::uint64_t
+    {
+        return (((head >> 32u) + 1u) << 32u) | index;
+    }
+};
+
+}  // namespace ox
+#endif  // TERMOX_COMMON_MPSC_QUEUE_HPP
@@ -0,0 +1,91 @@
+#ifndef TERMOX_COMMON_SEQLOCK_HPP
+#define TERMOX_COMMON_SEQLOCK_HPP
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace ox {
+
+/// Holds a value that is written often and read occasionally, without locks.
+/** Readers never block writers, a read that overlaps a write retries. For
+ *  values too large for std::atomic<T> to be lock free, such as a small struct
+ *  of statistics. Safe to use from any number of threads. */
+template <typename T>
+class Seqlock {
+   public:
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Seqlock is only for trivially copyable types.");
+    static_assert(std::is_default_constructible_v<T>,
+                  "Seqlock needs a default constructible type.");
+
+   public:
+    explicit Seqlock(T const& value = T{}) { this->write_words(value); }
+
+    Seqlock(Seqlock const&) = delete;
+    auto operator=(Seqlock const&) -> Seqlock& = delete;
+
+   public:
+    /// Replace the held value, concurrent writers are serialized.
+    void store(T const& value)
+    {
+        auto seq = sequence_.load(std::memory_order_relaxed);
+        while ((seq & 1u) != 0u ||
+               !sequence_.compare_exchange_weak(seq, seq + 1u,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+            seq = sequence_.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        this->write_words(value);
+        sequence_.store(seq + 2u, std::memory_order_release);
+    }
+
+    /// Return a copy of the most recently stored value.
+    auto load() const -> T
+    {
+        while (true) {
+            auto const before = sequence_.load(std::memory_order_acquire);
+            if ((before & 1u) != 0u)
+                continue;
+            auto value = this->read_words();
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before)
+                return value;
+        }
+    }
+
+   private:
+    using Word_t = std::uint64_t;
+    static constexpr auto word_count =
+        (sizeof(T) + sizeof(Word_t) - 1) / sizeof(Word_t);
+
+    // Even when no write is in progress.
+    std::atomic<std::uint32_t> sequence_ = 0;
+    // Relaxed atomic words, so an overlapping read is not a data race.
+    std::array<std::atomic<Word_t>, word_count> words_;
+
+   private:
+    void write_words(T const& value)
+    {
+        auto buffer = std::array<Word_t, word_count>{};
+        std::memcpy(buffer.data(), &value, sizeof(T));
+        for (auto i = 0uL; i < word_count; ++i)
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+    }
+
+    auto read_words() const -> T
+    {
+        auto buffer = std::array<Word_t, word_count>{};
+        for (auto i = 0uL; i < word_count; ++i)
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        auto value = T{};
+        std::memcpy(&value, buffer.data(), sizeof(T));
+        return value;
+    }
+};
+
+}  // namespace ox
+#endif  // TERMOX_COMMON_SEQLOCK_HPP
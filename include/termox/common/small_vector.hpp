@@ -0,0 +1,127 @@
+#ifndef TERMOX_COMMON_SMALL_VECTOR_HPP
+#define TERMOX_COMMON_SMALL_VECTOR_HPP
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ox {
+
+/// Vector that stores up to \p N elements in place before allocating.
+/** Restricted to trivially copyable element types, such as pointers. Order of
+ *  elements is preserved by all operations. */
+template <typename T, std::size_t N>
+class Small_vector {
+   public:
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Small_vector is only for trivially copyable types.");
+    static_assert(N > 0, "Small_vector must have some inline capacity.");
+
+   public:
+    using value_type     = T;
+    using iterator       = T*;
+    using const_iterator = T const*;
+
+   public:
+    Small_vector() = default;
+
+    Small_vector(Small_vector const& other) { this->assign(other); }
+
+    auto operator=(Small_vector const& other) -> Small_vector&
+    {
+        if (this != &other)
+            this->assign(other);
+        return *this;
+    }
+
+    Small_vector(Small_vector&& other) noexcept { this->steal(other); }
+
+    auto operator=(Small_vector&& other) noexcept -> Small_vector&
+    {
+        if (this != &other)
+            this->steal(other);
+        return *this;
+    }
+
+   public:
+    auto begin() -> iterator { return this->data(); }
+    auto begin() const -> const_iterator { return this->data(); }
+
+    auto end() -> iterator { return this->data() + size_; }
+    auto end() const -> const_iterator { return this->data() + size_; }
+
+    auto data() -> T* { return heap_ ? heap_.get() : inline_.data(); }
+    auto data() const -> T const*
+    {
+        return heap_ ? heap_.get() : inline_.data();
+    }
+
+    auto operator[](std::size_t i) -> T& { return this->data()[i]; }
+    auto operator[](std::size_t i) const -> T const& { return this->data()[i]; }
+
+    auto back() -> T& { return this->data()[size_ - 1uL]; }
+    auto back() const -> T const& { return this->data()[size_ - 1uL]; }
+
+    auto size() const -> std::size_t { return size_; }
+
+    auto empty() const -> bool { return size_ == 0uL; }
+
+    /// Return true if the elements are stored on the heap.
+    auto is_allocated() const -> bool { return heap_ != nullptr; }
+
+    void push_back(T value)
+    {
+        if (size_ == capacity_)
+            this->grow();
+        this->data()[size_++] = value;
+    }
+
+    void pop_back() { --size_; }
+
+    /// Remove the element at \p at, shifting later elements down.
+    auto erase(const_iterator at) -> iterator
+    {
+        auto const first = this->begin() + (at - this->begin());
+        std::copy(first + 1, this->end(), first);
+        --size_;
+        return first;
+    }
+
+    /// Keeps any heap allocation.
+    void clear() { size_ = 0uL; }
+
+   private:
+    std::array<T, N> inline_{};
+    std::unique_ptr<T[]> heap_;
+    std::size_t size_     = 0uL;
+    std::size_t capacity_ = N;
+
+   private:
+    void grow()
+    {
+        auto bigger = std::make_unique<T[]>(capacity_ * 2uL);
+        std::copy(this->begin(), this->end(), bigger.get());
+        heap_ = std::move(bigger);
+        capacity_ *= 2uL;
+    }
+
+    void assign(Small_vector const& other)
+    {
+        size_ = 0uL;
+        for (auto const& x : other)
+            this->push_back(x);
+    }
+
+    void steal(Small_vector& other)
+    {
+        heap_     = std::move(other.heap_);
+        inline_   = other.inline_;
+        size_     = std::exchange(other.size_, 0uL);
+        capacity_ = std::exchange(other.capacity_, N);
+    }
+};
+
+}  // namespace ox
+#endif  // TERMOX_COMMON_SMALL_VECTOR_HPP
@@ -0,0 +1,139 @@
+#ifndef TERMOX_PAINTER_DETAIL_RENDER_LIST_HPP
+#define TERMOX_PAINTER_DETAIL_RENDER_LIST_HPP
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include <termox/painter/detail/screen_mask.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+
+namespace ox {
+class Widget;
+}  // namespace ox
+
+namespace ox::detail {
+
+/// Flattened, structure-of-arrays snapshot of a Widget tree.
+/** Widgets are stored in depth-first pre-order, parents before children and
+ *  earlier siblings before later siblings. The index of a Widget is also its
+ *  z-order, later Widgets are painted over earlier ones. The descendants of
+ *  the Widget at index i are at [i + 1, subtree_end(i)), so traversals are
+ *  linear scans over contiguous arrays instead of pointer chasing.
+ *
+ *  current() is the snapshot of System::head(), it is rebuilt on first use
+ *  after invalidate(). The tree calls invalidate() when a child is inserted,
+ *  removed or swapped, when a Widget is enabled, disabled, moved, resized or
+ *  destroyed, and when a Border is changed. invalidate() is thread safe, the
+ *  rest is main thread only. */
+class Render_list {
+   public:
+    using Index = std::uint32_t;
+
+    /// Returned by find() for a Widget that is not in the list.
+    static auto constexpr npos = std::numeric_limits<Index>::max();
+
+    /// Position and size in global coordinates.
+    struct Rect {
+        Point top_left;
+        Area area;
+
+        /// Return true if \p p is within *this.
+        auto contains(Point p) const -> bool
+        {
+            return p.x >= top_left.x && p.x < top_left.x + area.width &&
+                   p.y >= top_left.y && p.y < top_left.y + area.height;
+        }
+    };
+
+   public:
+    /// Create an empty list, allocating from \p mr.
+    explicit Render_list(
+        std::pmr::memory_resource* mr = std::pmr::get_default_resource());
+
+   public:
+    /// Replace the contents with a snapshot of \p root and its descendants.
+    /** Reuses the existing capacity, only allocates if the tree has grown. */
+    void build(Widget& root);
+
+    /// Remove every Widget from the list, keeps the capacity.
+    void clear();
+
+    /// Return the number of Widgets in the list.
+    auto size() const -> std::size_t { return widgets_.size(); }
+
+    /// Return the index of \p w, or npos if \p w is not in the list.
+    auto find(Widget const& w) const -> Index;
+
+    /// Return the Widget at \p i.
+    auto widget(Index i) const -> Widget& { return *widgets_[i]; }
+
+    /// Return the index of the parent of \p i, or npos for the root.
+    auto parent(Index i) const -> Index { return parents_[i]; }
+
+    /// Return the number of ancestors of \p i within the list.
+    auto depth(Index i) const -> Index { return depths_[i]; }
+
+    /// Return one past the index of the last descendant of \p i.
+    auto subtree_end(Index i) const -> Index { return subtree_ends_[i]; }
+
+    /// Return the area of \p i including its border.
+    auto outer(Index i) const -> Rect const& { return outers_[i]; }
+
+    /// Return the area of \p i without its border.
+    auto inner(Index i) const -> Rect const& { return inners_[i]; }
+
+    /// Return Widget::is_enabled() of \p i.
+    auto is_enabled(Index i) const -> bool { return flags_[i] & Enabled; }
+
+    /// Return detail::is_paintable() of \p i.
+    auto is_paintable(Index i) const -> bool { return flags_[i] & Paintable; }
+
+    /// Return the topmost enabled Widget whose inner area contains \p p.
+    /** Each ancestor must also be enabled and contain \p p. Where siblings
+     *  overlap, the later sibling is on top and is returned, as it is in
+     *  z-order. Returns nullptr if no Widget is found. */
+    auto widget_at(Point p) const -> Widget*;
+
+    /// Return a mask of the inner area of \p i not covered by an enabled child.
+    /** Returns an empty mask if the children cover the entire inner area. The
+     *  mask is allocated from the Frame_arena. */
+    auto empty_space(Index i) const -> Screen_mask;
+
+   public:
+    /// Return the snapshot of System::head(), rebuilding it if invalidated.
+    static auto current() -> Render_list const&;
+
+    /// Mark current() as out of date with the Widget tree.
+    static void invalidate() { is_valid_.store(false); }
+
+   private:
+    enum Flag : std::uint8_t { Enabled = 1, Paintable = 2 };
+
+    template <typename T>
+    using Array_t = std::pmr::vector<T>;
+
+    Array_t<Widget*> widgets_;
+    Array_t<Index> parents_;
+    Array_t<Index> depths_;
+    Array_t<Index> subtree_ends_;
+    Array_t<Rect> outers_;
+    Array_t<Rect> inners_;
+    Array_t<std::uint8_t> flags_;
+
+    // Sorted by address, for find().
+    Array_t<std::pair<Widget const*, Index>> by_address_;
+
+    inline static std::atomic<bool> is_valid_{false};
+
+   private:
+    /// Append \p w and its descendants, \p w is a child of \p parent.
+    void append(Widget& w, Index parent, Index depth);
+};
+
+}  // namespace ox::detail
+#endif  // TERMOX_PAINTER_DETAIL_RENDER_LIST_HPP
@@ -1,6 +1,8 @@
 #ifndef TERMOX_PAINTER_DETAIL_SCREEN_DESCRIPTOR_HPP
 #define TERMOX_PAINTER_DETAIL_SCREEN_DESCRIPTOR_HPP
+#include <memory_resource>
 #include <unordered_map>
+#include <utility>
 
 #include <termox/painter/glyph.hpp>
 #include <termox/widget/area.hpp>
@@ -11,13 +13,33 @@ namespace ox::detail {
 // using Screen_descriptor = std::unordered_map<Point, Glyph>;
 
 /// Holds the screen state by Points on the screen and corresponding Glyphs.
-/** Points are in global coordinates. */
+/** Points are in global coordinates. Allocator aware, so a container with a
+ *  std::pmr allocator passes its memory resource down to each descriptor. */
 class Screen_descriptor {
    private:
-    using Map_t = std::unordered_map<Point, Glyph>;
+    using Map_t = std::pmr::unordered_map<Point, Glyph>;
 
    public:
-    using key_type = Map_t::key_type;
+    using key_type       = Map_t::key_type;
+    using allocator_type = Map_t::allocator_type;
+
+   public:
+    Screen_descriptor() = default;
+
+    explicit Screen_descriptor(allocator_type const& a) : map_{a} {}
+
+    Screen_descriptor(Screen_descriptor const& x, allocator_type const& a)
+        : map_{x.map_, a}, area_{x.area_}, top_left_{x.top_left_}
+    {}
+
+    Screen_descriptor(Screen_descriptor&& x, allocator_type const& a)
+        : map_{std::move(x.map_), a}, area_{x.area_}, top_left_{x.top_left_}
+    {}
+
+    Screen_descriptor(Screen_descriptor const&) = default;
+    Screen_descriptor(Screen_descriptor&&)      = default;
+    auto operator=(Screen_descriptor const&) -> Screen_descriptor& = default;
+    auto operator=(Screen_descriptor&&) -> Screen_descriptor& = default;
 
    public:
     /// removes elements outside of \p area if resize is smaller than previous.
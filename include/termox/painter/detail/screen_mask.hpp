@@ -1,6 +1,7 @@
 #ifndef TERMOX_PAINTER_DETAIL_SCREEN_MASK_HPP
 #define TERMOX_PAINTER_DETAIL_SCREEN_MASK_HPP
 #include <cstddef>
+#include <memory_resource>
 #include <vector>
 
 #include <termox/widget/area.hpp>
@@ -13,8 +14,8 @@ namespace detail {
 /// A 2D bitmask to indicate a binary feature for each point on a Widget.
 class Screen_mask {
    public:
-    using Reference       = typename std::vector<bool>::reference;
-    using Const_reference = typename std::vector<bool>::const_reference;
+    using Reference       = typename std::pmr::vector<bool>::reference;
+    using Const_reference = typename std::pmr::vector<bool>::const_reference;
 
     enum Constructor_tag { Outer, Inner };
 
@@ -23,8 +24,19 @@ class Screen_mask {
     Screen_mask() = default;
 
     /// Create an empty Screen_mask with the dimensions and position of \p w.
+    /** The bits are allocated from the Frame_arena. */
     Screen_mask(Widget const& w, Constructor_tag tag);
 
+    /// Create an empty Screen_mask at \p offset with dimensions \p area.
+    /** The bits are allocated from the Frame_arena. */
+    Screen_mask(Point offset, Area area);
+
+    // The bits are frame lifetime memory, copies invite keeping one around.
+    Screen_mask(Screen_mask const&) = delete;
+    Screen_mask(Screen_mask&&)      = default;
+    auto operator=(Screen_mask const&) -> Screen_mask& = delete;
+    auto operator=(Screen_mask&&) -> Screen_mask& = default;
+
     /// Return the offset of the Widget on the screen, top left point.
     auto offset() const -> Point { return offset_; }
 
@@ -63,7 +75,7 @@ class Screen_mask {
    private:
     Point offset_;
     Area area_;
-    std::vector<bool> bits_;
+    std::pmr::vector<bool> bits_;
 };
 
 }  // namespace detail
@@ -1,6 +1,12 @@
 #ifndef TERMOX_PAINTER_DETAIL_STAGED_CHANGES_HPP
 #define TERMOX_PAINTER_DETAIL_STAGED_CHANGES_HPP
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <termox/painter/detail/screen_descriptor.hpp>
 
@@ -8,18 +14,75 @@ namespace ox {
 class Widget;
 namespace detail {
 
-/// Global map holds the changes to be flushed to the screen.
+/// Holds the changes to be flushed to the screen, staged per thread.
+/** Each thread that paints gets its own Arena, so a Painter never shares a map
+ *  with another thread. At flush, the thread running the Event_engine merges
+ *  every other Arena into its own, each under that Arena's lock. The registry
+ *  of Arenas is always locked before an Arena, and never while holding one. */
 class Staged_changes {
    public:
-    using Map_t = std::unordered_map<Widget*, Screen_descriptor>;
+    /// Identifies the Widget that staged changes, by address and unique_id.
+    /** Widget addresses are reused once a Widget is destroyed, the unique_id
+     *  keeps a tombstone for a destroyed Widget from removing the changes of
+     *  a new Widget allocated at the same address. */
+    struct Key {
+        Widget* widget;
+        std::uint16_t id;
+
+        friend auto operator==(Key a, Key b) -> bool
+        {
+            return a.widget == b.widget && a.id == b.id;
+        }
+    };
+
+    struct Key_hash {
+        auto operator()(Key k) const -> std::size_t
+        {
+            return std::hash<Widget*>{}(k.widget) ^ k.id;
+        }
+    };
+
+    using Map_t = std::pmr::unordered_map<Key, Screen_descriptor, Key_hash>;
+
+    /// Return the Key that \p w stages its changes under.
+    static auto key(Widget const& w) -> Key;
+
+    /// A single thread's staged changes, locked while the thread paints.
+    /** Recursive, a paint_event() can hold a Painter while the base class
+     *  paint_event() creates another. Map nodes and each Screen_descriptor's
+     *  storage come from pool, which keeps memory released by a flush for the
+     *  next frame's painting. */
+    struct Arena {
+        std::recursive_mutex mtx;
+        std::pmr::unsynchronized_pool_resource pool;
+        Map_t changes{&pool};
+        // Destroyed on this thread, to be removed from the other Arenas.
+        std::pmr::vector<Key> tombstones{&pool};
+
+        Arena();
+        ~Arena();
+    };
 
    public:
-    /// Return the global Staged_changes map object.
-    static auto get() -> Map_t&
+    /// Return the calling thread's Arena, created and registered on first use.
+    static auto local() -> Arena&
     {
-        static auto changes = Map_t{};
-        return changes;
+        thread_local auto arena = Arena{};
+        return arena;
     }
+
+    /// Merge all other threads' Arenas into the calling thread's Arena.
+    /** Returns the calling thread's merged changes, other threads' changes are
+     *  applied over its own. Waits for each Arena's lock, which a Painter
+     *  holds for its lifetime, so another thread's Painter is merged either
+     *  entirely or not until the next flush. Applies every Arena's tombstones
+     *  before merging. Called by the Event_engine at flush. */
+    static auto collect() -> Map_t&;
+
+    /// Remove any changes staged for \p w.
+    /** Only locks the calling thread's Arena. If other threads have Arenas, a
+     *  tombstone is left for collect() to remove \p w from them as well. */
+    static void discard(Widget const& w);
 };
 
 }  // namespace detail
@@ -1,6 +1,7 @@
 #ifndef TERMOX_PAINTER_PAINTER_HPP
 #define TERMOX_PAINTER_PAINTER_HPP
 #include <cstddef>
+#include <mutex>
 
 #include <termox/painter/detail/screen_descriptor.hpp>
 #include <termox/painter/detail/staged_changes.hpp>
@@ -110,8 +111,11 @@ class Painter {
     Area const inner_area_;
     bool const is_paintable_;
 
+    /// Held for the Painter's lifetime, so a flush can't merge mid-paint.
+    std::unique_lock<std::recursive_mutex> staging_lock_;
+
     /// Reference to container that holds onto the painting until flush().
-    /** Each Event_loop/thread has a Screen_descriptor for each Widget. */
+    /** Each thread has its own Screen_descriptor for each Widget. */
     detail::Screen_descriptor& staged_changes_;
 };
 
@@ -1,29 +1,30 @@
 #ifndef TERMOX_SYSTEM_ANIMATION_ENGINE_HPP
 #define TERMOX_SYSTEM_ANIMATION_ENGINE_HPP
-#include <memory>
-#include <vector>
+#include <map>
 
-#include <termox/system/detail/timer_event_loop.hpp>
+#include <termox/system/detail/interval_event_loop.hpp>
+#include <termox/system/timer_scheduler.hpp>
 
 namespace ox {
 class Widget;
 
-/// Manages all Timer_event_loops, grouping by period.
+/// Posts Timer_events to registered Widgets through the Timer_scheduler.
+/** Every Widget gets its own repeating timer on the single scheduler thread,
+ *  no matter how many distinct periods are in use. A Widget's timer is
+ *  suspended while it is not paintable, see update_visibility(). Should only be
+ *  used from the main thread. */
 class Animation_engine {
    public:
-    using Period_t = detail::Timer_event_loop::Period_t;
+    using Period_t = Timer_scheduler::Period_t;
 
    public:
-    ~Animation_engine()
-    {
-        for (auto& loop : loops_) {
-            loop->exit(0);
-            loop->wait();
-        }
-    }
+    Animation_engine() : scheduler_{Timer_scheduler::get()} {}
+
+    ~Animation_engine() { this->shutdown(); }
 
    public:
     /// Begins posting Timer_events to the given Widget every period.
+    /** Replaces the period if \p w is already registered. */
     void register_widget(Widget& w, Period_t interval);
 
     /// Begins posting Timer_events to the given Widget at \p fps.
@@ -32,40 +33,36 @@ class Animation_engine {
     /// Stop posting Timer_events to a given Widget.
     void unregister_widget(Widget& w);
 
+    /// Suspend or resume \p w's timer to match whether \p w is paintable.
+    /** Called by Widget when it is enabled, disabled or resized. A disabled or
+     *  zero area Widget would drop its Timer_events, so none are posted. */
+    void update_visibility(Widget& w);
+
     // Start sending Timer_events to all registered widgets.
     /** Only needed if shutdown() has been called. */
     void startup();
 
-    /// Send stop signals to all event loops and wait for them to exit.
+    /// Stop sending Timer_events, registrations are kept for startup().
     void shutdown();
 
    private:
-    // Using a std::unique_ptr because Event_loops can't be copied.
-    using Loop_t = std::unique_ptr<detail::Timer_event_loop>;
-    std::vector<Loop_t> loops_;
+    struct Registration {
+        Period_t period;
+        Timer_scheduler::Id timer = 0;  // Zero if shutdown or suspended.
+        bool is_suspended         = false;
+    };
+
+    // The scheduler is constructed first, so that it is destroyed after this.
+    Timer_scheduler& scheduler_;
+    std::map<Widget*, Registration> registered_;
+    bool is_running_ = true;
 
    private:
-    /// Find and return iterator pointing to Event Loop with \p interval.
-    /** Returns std::end(loops_) if no loop found with \p interval. */
-    auto get_loop_iter_with(Period_t interval) const
-    {
-        return std::find_if(std::begin(loops_), std::end(loops_),
-                            [interval](auto const& loop) {
-                                return loop->get_interval() == interval;
-                            });
-    }
-
-    /// Return true if there is already an Event_loop for \p interval.
-    auto has_loop_with(Period_t interval) const -> bool
-    {
-        return this->get_loop_iter_with(interval) != std::end(loops_);
-    }
-
-    /// Assumes that the Event Loop does exist, otherwise undefined behavior.
-    auto get_loop_with(Period_t interval) -> detail::Timer_event_loop&
-    {
-        return **this->get_loop_iter_with(interval);
-    }
+    /// Add a repeating timer posting Timer_events to \p w every \p period.
+    auto start_timer(Widget& w, Period_t period) -> Timer_scheduler::Id;
+
+    /// Start or cancel the timer of \p w to match running and suspended state.
+    void sync_timer(Widget& w, Registration& registration);
 };
 
 }  // namespace ox
@@ -0,0 +1,198 @@
+#ifndef TERMOX_SYSTEM_ASYNC_HPP
+#define TERMOX_SYSTEM_ASYNC_HPP
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <signals_light/signal.hpp>
+
+#include <termox/system/event.hpp>
+#include <termox/system/system.hpp>
+#include <termox/system/thread_pool.hpp>
+
+namespace ox::detail {
+
+/// Result of a background task, shared between the worker and the handle.
+template <typename R>
+class Async_state {
+   public:
+    /// Run \p fn and store its result or exception, then post continuation.
+    template <typename F>
+    void run(F& fn)
+    {
+        try {
+            if constexpr (std::is_void_v<R>) {
+                fn();
+                this->complete(true, nullptr);
+            }
+            else
+                this->complete(fn(), nullptr);
+        }
+        catch (...) {
+            this->complete(std::nullopt, std::current_exception());
+        }
+    }
+
+    /// Post \p fn to the main thread once the result is stored.
+    /** Posts immediately if the task has already completed. */
+    void set_continuation(std::function<void()> fn)
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        if (is_done_)
+            post(std::move(fn));
+        else
+            continuation_ = std::move(fn);
+    }
+
+    /// Return the stored result, or rethrow the stored exception.
+    /** Only valid to call once, from the posted continuation. */
+    auto take() -> R
+    {
+        if (error_ != nullptr)
+            std::rethrow_exception(error_);
+        if constexpr (!std::is_void_v<R>)
+            return std::move(*value_);
+    }
+
+   private:
+    using Value_t = std::conditional_t<std::is_void_v<R>, bool, R>;
+
+    std::mutex mtx_;
+    std::optional<Value_t> value_;
+    std::exception_ptr error_;
+    std::function<void()> continuation_;
+    bool is_done_ = false;
+
+   private:
+    void complete(std::optional<Value_t> value, std::exception_ptr error)
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        value_          = std::move(value);
+        error_          = std::move(error);
+        is_done_        = true;
+        if (continuation_)
+            post(std::move(continuation_));
+    }
+
+    static void post(std::function<void()> fn)
+    {
+        System::post_event(Custom_event{[fn = std::move(fn)] { fn(); }});
+    }
+};
+
+/// The function type that receives the result of a task returning \p R.
+template <typename R>
+struct Continuation {
+    using type = std::function<void(R)>;
+};
+
+template <>
+struct Continuation<void> {
+    using type = std::function<void()>;
+};
+
+}  // namespace ox::detail
+
+namespace ox {
+
+/// Handle to a task running on a Thread_pool, see ox::async().
+/** The task runs whether or not a continuation is attached. */
+template <typename R>
+class Async_task {
+   public:
+    using Continuation_t = typename detail::Continuation<R>::type;
+
+    /// Called instead of the continuation if the task threw.
+    using Error_handler_t = std::function<void(std::exception const&)>;
+
+   public:
+    explicit Async_task(std::shared_ptr<detail::Async_state<R>> state)
+        : state_{std::move(state)}
+    {}
+
+   public:
+    /// Call \p done with the task's result on the main thread.
+    /** If the task or \p done throws a std::exception, \p failed is called
+     *  with it. Without \p failed, or for other exceptions, it is rethrown on
+     *  the main thread. Only valid to call once. */
+    void then_on_main(Continuation_t done, Error_handler_t failed = nullptr)
+    {
+        state_->set_continuation(
+            [state = state_, done = std::move(done),
+             failed = std::move(failed)] { invoke(*state, done, failed); });
+    }
+
+    /// Call \p done on the main thread, unless \p lifetime has ended by then.
+    /** Typically passed a Widget's lifetime member, so that the continuation
+     *  is cancelled if the Widget is destroyed while the task is running. */
+    void then_on_main(sl::Lifetime const& lifetime,
+                      Continuation_t done,
+                      Error_handler_t failed = nullptr)
+    {
+        auto slot = sl::Slot<void()>{
+            [state = state_, done = std::move(done),
+             failed = std::move(failed)] { invoke(*state, done, failed); }};
+        slot.track(lifetime);
+        auto tracked = std::make_shared<sl::Signal<void()>>();
+        tracked->connect(slot);
+        state_->set_continuation([tracked] { tracked->emit(); });
+    }
+
+   private:
+    std::shared_ptr<detail::Async_state<R>> state_;
+
+   private:
+    static void invoke(detail::Async_state<R>& state,
+                       Continuation_t const& done,
+                       Error_handler_t const& failed)
+    {
+        if (failed == nullptr) {
+            call(state, done);
+            return;
+        }
+        try {
+            call(state, done);
+        }
+        catch (std::exception const& e) {
+            failed(e);
+        }
+    }
+
+    static void call(detail::Async_state<R>& state, Continuation_t const& done)
+    {
+        if constexpr (std::is_void_v<R>) {
+            state.take();
+            done();
+        }
+        else
+            done(state.take());
+    }
+};
+
+/// Run \p fn on \p pool, returns a handle to attach a main thread continuation.
+template <typename F>
+auto async(Thread_pool& pool, F&& fn) -> Async_task<std::invoke_result_t<F&>>
+{
+    using Result_t = std::invoke_result_t<F&>;
+    auto state     = std::make_shared<detail::Async_state<Result_t>>();
+    pool.submit(
+        [state, fn = std::forward<F>(fn)]() mutable { state->run(fn); });
+    return Async_task<Result_t>{std::move(state)};
+}
+
+/// Run \p fn on System::thread_pool().
+/** ox::async([] { return load(); }).then_on_main([](auto x) { show(x); });
+ *  The continuation is sent as a Custom_event, so it runs on the main thread
+ *  and can safely modify Widgets. */
+template <typename F>
+auto async(F&& fn) -> Async_task<std::invoke_result_t<F&>>
+{
+    return async(System::thread_pool(), std::forward<F>(fn));
+}
+
+}  // namespace ox
+#endif  // TERMOX_SYSTEM_ASYNC_HPP
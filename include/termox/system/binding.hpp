@@ -0,0 +1,76 @@
+#ifndef TERMOX_SYSTEM_BINDING_HPP
+#define TERMOX_SYSTEM_BINDING_HPP
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <termox/system/frame_clock.hpp>
+#include <termox/system/system.hpp>
+
+namespace ox {
+
+/// Keeps a polling callback registered with the Frame_clock, see ox::bind().
+/** Removes the callback when destroyed. Should only be used from the main
+ *  thread. */
+class Binding {
+   public:
+    Binding() = default;
+
+    explicit Binding(Frame_clock::Id id) : id_{id} {}
+
+    Binding(Binding const&) = delete;
+    auto operator=(Binding const&) -> Binding& = delete;
+
+    Binding(Binding&& other) noexcept : id_{std::exchange(other.id_, 0)} {}
+
+    auto operator=(Binding&& other) noexcept -> Binding&
+    {
+        if (this != &other) {
+            this->release();
+            id_ = std::exchange(other.id_, 0);
+        }
+        return *this;
+    }
+
+    ~Binding() { this->release(); }
+
+   public:
+    /// Stop polling, no-op if already released.
+    void release()
+    {
+        if (id_ == 0)
+            return;
+        System::frame_clock().remove(id_);
+        id_ = 0;
+    }
+
+    /// Return true if still polling.
+    auto is_bound() const -> bool { return id_ != 0; }
+
+   private:
+    Frame_clock::Id id_ = 0;
+};
+
+/// Call \p apply with the value of \p source on each frame where it changed.
+/** \p source is any object with a thread safe load(), such as std::atomic<T>
+ *  or ox::Seqlock<T>, with an equality comparable value type. It is read once
+ *  per frame, before painting. Producers can store as often as they like, only
+ *  the latest value is applied. \p apply runs on the main thread, it is also
+ *  called on the first frame. \p source must outlive the returned Binding. */
+template <typename Source, typename F>
+[[nodiscard]] auto bind(Source const& source, F apply) -> Binding
+{
+    using Value_t = std::decay_t<decltype(source.load())>;
+    return Binding{System::frame_clock().on_frame(
+        [&source, apply = std::move(apply),
+         last = std::optional<Value_t>{}](Frame_clock::Duration_t) mutable {
+            auto value = source.load();
+            if (last.has_value() && *last == value)
+                return;
+            last = value;
+            apply(std::move(value));
+        })};
+}
+
+}  // namespace ox
+#endif  // TERMOX_SYSTEM_BINDING_HPP
@@ -0,0 +1,171 @@
+#ifndef TERMOX_SYSTEM_CHANNEL_HPP
+#define TERMOX_SYSTEM_CHANNEL_HPP
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <termox/system/detail/channel_base.hpp>
+#include <termox/system/detail/event_engine.hpp>
+#include <termox/system/system.hpp>
+
+namespace ox {
+
+/// What a Channel does with a value sent to it while it is full.
+enum class Overflow {
+    Block,          // The sending thread waits until the main thread drains.
+    Drop_oldest,    // The oldest queued value is discarded.
+    Replace_by_key  // A queued value with an equal key is overwritten.
+};
+
+/// Bounded queue for sending values from any thread to the main thread.
+/** Queued values are drained once per frame, before any queued Events are
+ *  processed, and handed to the receive function on the main thread in the
+ *  order they were sent. Memory use and latency stay bounded by capacity when
+ *  producers outpace the UI, unlike posting a Custom_event per value.
+ *
+ *  With Overflow::Replace_by_key, a sent value overwrites any queued value
+ *  that has an equal key, whether or not the Channel is full. If no queued
+ *  value matches and the Channel is full, the oldest value is dropped.
+ *
+ *  Overflow::Block must not be used from the main thread, it would wait on
+ *  itself. The Channel must outlive any threads sending to it. */
+template <typename T, typename Key = std::size_t>
+class Channel : private detail::Channel_base {
+   public:
+    using Receive_t = std::function<void(T)>;
+    using Key_of_t  = std::function<Key(T const&)>;
+
+   public:
+    /// Create a Channel and register it with the System's Event_engine.
+    /** \p key_of is required for Overflow::Replace_by_key, and is otherwise
+     *  unused. Throws std::invalid_argument if \p capacity is zero or a
+     *  required \p key_of is missing. */
+    Channel(std::string name,
+            std::size_t capacity,
+            Overflow overflow,
+            Receive_t receive,
+            Key_of_t key_of = nullptr)
+        : name_{std::move(name)},
+          capacity_{capacity},
+          overflow_{overflow},
+          receive_{std::move(receive)},
+          key_of_{std::move(key_of)}
+    {
+        if (capacity_ == 0uL)
+            throw std::invalid_argument{"Channel: capacity must be nonzero."};
+        if (overflow_ == Overflow::Replace_by_key && key_of_ == nullptr)
+            throw std::invalid_argument{"Channel: Replace_by_key needs key_of."};
+        System::event_engine().register_channel(*this);
+    }
+
+    Channel(Channel const&) = delete;
+    Channel(Channel&&)      = delete;
+    auto operator=(Channel const&) -> Channel& = delete;
+    auto operator=(Channel&&) -> Channel& = delete;
+
+    ~Channel()
+    {
+        System::event_engine().unregister_channel(*this);
+        {
+            auto const lock = std::scoped_lock{mtx_};
+            is_closed_      = true;
+        }
+        has_space_.notify_all();
+    }
+
+   public:
+    /// Queue \p value to be received on the main thread, safe from any thread.
+    /** Applies the Overflow policy if the Channel is full. Returns false if
+     *  \p value was not queued, only when a blocked Channel is destroyed. */
+    auto send(T value) -> bool
+    {
+        auto lock = std::unique_lock{mtx_};
+        switch (overflow_) {
+            case Overflow::Block:
+                has_space_.wait(lock, [this] {
+                    return is_closed_ || values_.size() < capacity_;
+                });
+                if (is_closed_)
+                    return false;
+                break;
+            case Overflow::Replace_by_key:
+                if (this->replace_by_key(value))
+                    return true;
+                [[fallthrough]];
+            case Overflow::Drop_oldest:
+                if (values_.size() == capacity_) {
+                    values_.pop_front();
+                    ++dropped_count_;
+                }
+                break;
+        }
+        values_.push_back(std::move(value));
+        return true;
+    }
+
+    /// Return the name given at construction, for identification.
+    auto name() const -> std::string const& { return name_; }
+
+    /// Return the maximum number of values queued at once.
+    auto capacity() const -> std::size_t { return capacity_; }
+
+    /// Return the number of values discarded by Overflow::Drop_oldest.
+    /** Also counts values dropped by Replace_by_key with no matching key. */
+    auto dropped_count() const -> std::size_t
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        return dropped_count_;
+    }
+
+   private:
+    std::string const name_;
+    std::size_t const capacity_;
+    Overflow const overflow_;
+    Receive_t receive_;
+    Key_of_t key_of_;
+
+    std::deque<T> values_;
+    std::deque<T> drained_;  // Main thread only, its storage is reused.
+    std::size_t dropped_count_ = 0uL;
+    bool is_closed_            = false;
+    mutable std::mutex mtx_;
+    std::condition_variable has_space_;
+
+   private:
+    void drain() override
+    {
+        {
+            auto const lock = std::scoped_lock{mtx_};
+            drained_.swap(values_);
+        }
+        if (overflow_ == Overflow::Block)
+            has_space_.notify_all();
+        for (auto& value : drained_)
+            receive_(std::move(value));
+        drained_.clear();
+    }
+
+    /// Overwrite a queued value with the same key as \p value, if one exists.
+    /** Returns true if a value was overwritten. Expects mtx_ to be locked. */
+    auto replace_by_key(T& value) -> bool
+    {
+        auto const key = key_of_(value);
+        auto const at  = std::find_if(
+            std::begin(values_), std::end(values_),
+            [&](T const& queued) { return key_of_(queued) == key; });
+        if (at == std::end(values_))
+            return false;
+        *at = std::move(value);
+        return true;
+    }
+};
+
+}  // namespace ox
+#endif  // TERMOX_SYSTEM_CHANNEL_HPP
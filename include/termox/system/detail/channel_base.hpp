@@ -0,0 +1,16 @@
+#ifndef TERMOX_SYSTEM_DETAIL_CHANNEL_BASE_HPP
+#define TERMOX_SYSTEM_DETAIL_CHANNEL_BASE_HPP
+
+namespace ox::detail {
+
+/// Type erased interface the Event_engine uses to drain each ox::Channel.
+class Channel_base {
+   public:
+    virtual ~Channel_base() = default;
+
+    /// Hand every queued value to the receiver, called on the main thread.
+    virtual void drain() = 0;
+};
+
+}  // namespace ox::detail
+#endif  // TERMOX_SYSTEM_DETAIL_CHANNEL_BASE_HPP
@@ -1,11 +1,19 @@
 #ifndef TERMOX_SYSTEM_DETAIL_EVENT_ENGINE_HPP
 #define TERMOX_SYSTEM_DETAIL_EVENT_ENGINE_HPP
+#include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <termox/painter/detail/screen.hpp>
 #include <termox/painter/detail/staged_changes.hpp>
+#include <termox/system/detail/channel_base.hpp>
 #include <termox/system/detail/event_queue.hpp>
+#include <termox/system/detail/frame_arena.hpp>
 #include <termox/system/event.hpp>
+#include <termox/system/frame_clock.hpp>
 #include <termox/system/system.hpp>
 
 namespace ox::detail {
@@ -14,20 +22,69 @@ namespace ox::detail {
 class Event_engine {
    public:
     /// Invokes events and flush the screen.
+    /** Frame_clock callbacks run first, so their updates are painted with the
+     *  rest of this frame. Frame_arena memory is released after the flush. */
     void process()
     {
-        queue_.send_all();
+        Frame_arena::begin_frame();
+        this->drain_channels();
+        auto const now = Event_queue::Clock_t::now();
+        System::frame_clock().tick(now);
+        queue_.send_all(now + frame_budget_);
         flush_screen();
+        Frame_arena::end_frame();
+    }
+
+    /// Set the time each process() call may spend on Timer and Custom Events.
+    /** Once the budget is spent, remaining Timer and Custom Events are left
+     *  for the next frame so that input is not delayed. Default is 16ms. */
+    void set_frame_budget(std::chrono::microseconds budget)
+    {
+        frame_budget_ = budget;
+    }
+
+    /// Return the currently set frame budget.
+    auto frame_budget() const -> std::chrono::microseconds
+    {
+        return frame_budget_;
+    }
+
+    /// Add \p c to the Channels drained at the start of each process() call.
+    void register_channel(Channel_base& c)
+    {
+        auto const lock = std::scoped_lock{channels_mtx_};
+        channels_.push_back(&c);
+    }
+
+    /// Stop draining \p c, safe to call from within a Channel's receiver.
+    void unregister_channel(Channel_base& c)
+    {
+        auto const lock = std::scoped_lock{channels_mtx_};
+        std::replace(std::begin(channels_), std::end(channels_), &c,
+                     static_cast<Channel_base*>(nullptr));
     }
 
     /// Return a reference to the internal Event_queue.
     auto queue() -> Event_queue& { return queue_; }
 
    private:
+    void drain_channels()
+    {
+        auto const lock = std::scoped_lock{channels_mtx_};
+        // Indexed, a receiver can register a new Channel while draining.
+        for (auto i = 0uL; i < channels_.size(); ++i) {
+            if (channels_[i] != nullptr)
+                channels_[i]->drain();
+        }
+        channels_.erase(std::remove(std::begin(channels_), std::end(channels_),
+                                    static_cast<Channel_base*>(nullptr)),
+                        std::end(channels_));
+    }
+
     /// Flushes all of the staged changes to the screen and sets the cursor.
     static void flush_screen()
     {
-        auto& staged_changes = Staged_changes::get();
+        auto& staged_changes = Staged_changes::collect();
         Screen::flush(staged_changes);
         staged_changes.clear();
         Screen::display_cursor();
@@ -35,6 +92,9 @@ class Event_engine {
 
    private:
     Event_queue queue_;
+    std::vector<Channel_base*> channels_;
+    std::recursive_mutex channels_mtx_;
+    std::chrono::microseconds frame_budget_{16'000};
 };
 
 }  // namespace ox::detail
@@ -1,44 +1,131 @@
 #ifndef TERMOX_SYSTEM_DETAIL_EVENT_QUEUE_HPP
 #define TERMOX_SYSTEM_DETAIL_EVENT_QUEUE_HPP
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <map>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
-#include <set>
+#include <optional>
+#include <tuple>
 #include <utility>
 #include <variant>
 #include <vector>
 
 #include <termox/common/lockable.hpp>
+#include <termox/common/mpsc_queue.hpp>
+#include <termox/painter/detail/render_list.hpp>
+#include <termox/system/detail/frame_arena.hpp>
 #include <termox/system/event.hpp>
 #include <termox/system/system.hpp>
 #include <termox/widget/widget.hpp>
 
-namespace ox {
-inline auto operator<(Paint_event const& x, Paint_event const& y) -> bool
-{
-    return std::addressof(x.receiver.get()) < std::addressof(y.receiver.get());
-}
-}  // namespace ox
-
 namespace ox::detail {
 
+/// Holds the Widgets that need to be painted, each at most once.
+/** A Widget's needs_paint() flag is set when it is appended, so repeated
+ *  update() calls in a frame are a single flag check. Widgets are painted in
+ *  depth-first tree order, parents before children and earlier siblings
+ *  before later siblings, so overlaps resolve the same way every frame. */
 class Paint_queue : public Lockable<std::mutex> {
    public:
     void append(Paint_event e)
     {
+        auto& w = e.receiver.get();
+        if (w.needs_paint().exchange(true))
+            return;
         auto const lock = this->Lockable::lock();
-        paints_.insert(std::move(e));
+        dirty_.push_back(&w);
     }
 
     void send_all()
+    {
+        {
+            auto const lock = this->Lockable::lock();
+            painting_.swap(dirty_);
+        }
+        sort_by_tree_order(painting_);
+        for (auto* const w : painting_) {
+            if (w == nullptr)
+                continue;
+            w->needs_paint().store(false);
+            System::send_event(Paint_event{*w});
+        }
+        painting_.clear();
+    }
+
+    /// Remove \p w from the queue, called when a pending Widget is destroyed.
+    void discard_paint(Widget& w)
     {
         auto const lock = this->Lockable::lock();
-        for (auto& p : paints_)
-            System::send_event(std::move(p));
-        paints_.clear();
+        std::replace(std::begin(dirty_), std::end(dirty_), &w,
+                     static_cast<Widget*>(nullptr));
+        std::replace(std::begin(painting_), std::end(painting_), &w,
+                     static_cast<Widget*>(nullptr));
     }
 
    private:
-    std::set<Paint_event> paints_;
+    std::vector<Widget*> dirty_;
+    std::vector<Widget*> painting_;
+
+   private:
+    /// Sort \p widgets into depth-first order, by Render_list index.
+    /** The key of each Widget is its depth-first position within its tree,
+     *  looked up in Render_list::current() for Widgets under System::head().
+     *  Any other tree is flattened once into a Render_list of its own.
+     *  Temporaries are allocated from the Frame_arena. */
+    static void sort_by_tree_order(std::vector<Widget*>& widgets)
+    {
+        if (widgets.size() < 2uL)
+            return;
+        using Index = Render_list::Index;
+        struct Keyed {
+            std::size_t tree;  // 0 is System::head(), then other_trees.
+            Index index;
+            Widget* widget;
+        };
+        auto* const arena = Frame_arena::resource();
+        auto keyed        = std::pmr::vector<Keyed>{arena};
+        auto other_trees  = std::pmr::vector<Render_list>{arena};
+        keyed.reserve(widgets.size());
+        auto const& head_tree = Render_list::current();
+        for (auto* const w : widgets) {
+            if (w == nullptr) {
+                keyed.push_back(
+                    {static_cast<std::size_t>(-1), Render_list::npos, w});
+                continue;
+            }
+            if (auto const i = head_tree.find(*w); i != Render_list::npos) {
+                keyed.push_back({0uL, i, w});
+                continue;
+            }
+            auto tree = 0uL;
+            auto i    = Render_list::npos;
+            while (tree < other_trees.size() && i == Render_list::npos)
+                i = other_trees[tree++].find(*w);
+            if (i == Render_list::npos) {
+                auto* root = w;
+                while (root->parent() != nullptr)
+                    root = root->parent();
+                other_trees.emplace_back(arena).build(*root);
+                tree = other_trees.size();
+                i    = other_trees.back().find(*w);
+            }
+            keyed.push_back({tree, i, w});
+        }
+        std::sort(std::begin(keyed), std::end(keyed),
+                  [](Keyed const& a, Keyed const& b) {
+                      return std::tie(a.tree, a.index) <
+                             std::tie(b.tree, b.index);
+                  });
+        for (auto i = 0uL; i < keyed.size(); ++i)
+            widgets[i] = keyed[i].widget;
+    }
 };
 
 class Delete_queue : public Lockable<std::mutex> {
@@ -49,102 +136,465 @@ class Delete_queue : public Lockable<std::mutex> {
         deletes_.push_back(std::move(e));
     }
 
+    /// Send all Delete_events, then destroy every removed Widget at once.
+    /** All delete_event() handlers run before any Widget is destroyed. Not
+     *  locked while sending, Delete_events posted by a handler or destructor
+     *  are sent on the next frame. */
     void send_all()
     {
-        auto const lock = this->Lockable::lock();
-        for (auto& d : deletes_)
-            System::send_event(std::move(d));
-        deletes_.clear();
+        {
+            auto const lock = this->Lockable::lock();
+            std::swap(deletes_, sending_);
+        }
+        for (auto& d : sending_)
+            removed_.push_back(System::send_event(std::move(d)));
+        sending_.clear();
+        removed_.clear();
     }
 
    private:
     std::vector<Delete_event> deletes_;
+    std::vector<Delete_event> sending_;
+    std::vector<std::unique_ptr<Widget>> removed_;
 };
 
 // Mutex/Threading Notes
 // The main thread is the only thread that can call Event_queue::send_all()
-// Events are removed from the queue which a lock, then processed without a lock
-// This does not require a recursive mutex because event is processed w/o lock.
-// Paint and Delete Events should not be accessing functions that access the
-// queue, so they can remain locked while processing.
+// Basic Events are appended lock-free, the main thread detaches all pending
+// Events at once and processes them without holding anything.
+// Each appended Event is stamped with a Sequence, so Events held in different
+// queues are still sent in the order they were posted.
+// Delete Events are detached under the lock and sent without it, the removed
+// Widgets are destroyed together after every Delete Event has been sent.
+
+/// Position of an Event in the order Events were posted, across all queues.
+using Sequence = std::uint64_t;
 
-class Basic_queue : public Lockable<std::mutex> {
+/// Returned when a queue has no pending Event.
+auto constexpr no_sequence = std::numeric_limits<Sequence>::max();
+
+/// An Event and its position in posting order.
+struct Sequenced_event {
+    Sequence sequence;
+    Event event;
+};
+
+/// Return true if \p e is sent to, or refers to, \p w.
+template <typename T>
+auto refers_to(T const& e, Widget const& w) -> bool
+{
+    return std::addressof(e.receiver.get()) == &w;
+}
+
+inline auto refers_to(Child_added_event const& e, Widget const& w) -> bool
+{
+    return std::addressof(e.receiver.get()) == &w ||
+           std::addressof(e.child.get()) == &w;
+}
+
+inline auto refers_to(Child_removed_event const& e, Widget const& w) -> bool
+{
+    return std::addressof(e.receiver.get()) == &w ||
+           std::addressof(e.child.get()) == &w;
+}
+
+inline auto refers_to(Child_polished_event const& e, Widget const& w) -> bool
+{
+    return std::addressof(e.receiver.get()) == &w ||
+           std::addressof(e.child.get()) == &w;
+}
+
+/// Delete_events own their Widget, Custom_events have no receiver.
+inline auto refers_to(Delete_event const&, Widget const&) -> bool
+{
+    return false;
+}
+
+inline auto refers_to(Custom_event const&, Widget const&) -> bool
+{
+    return false;
+}
+
+inline auto refers_to(Sequenced_event const& e, Widget const& w) -> bool
+{
+    return std::visit([&w](auto const& e) { return refers_to(e, w); },
+                      e.event);
+}
+
+/// Erase the Events in [\p first, end) of \p events that refer to \p w.
+/** Returns true if any Event was erased. */
+inline auto erase_refers_to(std::vector<Sequenced_event>& events,
+                            std::size_t first,
+                            Widget const& w) -> bool
+{
+    auto const begin = std::begin(events) + static_cast<long>(first);
+    auto const end =
+        std::remove_if(begin, std::end(events), [&w](auto const& e) {
+            return refers_to(e, w);
+        });
+    if (end == std::end(events))
+        return false;
+    events.erase(end, std::end(events));
+    return true;
+}
+
+class Basic_queue {
    public:
-    void append(Event e)
+    void append(Sequence s, Event e) { basics_.push({s, std::move(e)}); }
+
+    /// Move all Events appended so far into \p f, in the order appended.
+    template <typename F>
+    void take_all(F&& f)
     {
-        auto const lock = this->Lockable::lock();
-        basics_.push_back(std::move(e));
+        basics_.consume_segment(std::forward<F>(f));
     }
 
-    void send_all()
+   private:
+    MPSC_queue<Sequenced_event> basics_;
+};
+
+/// Holds at most one pending Event per receiver and Event type.
+/** Used for Events where only the latest is meaningful. Appending an Event
+ *  that already has a pending counterpart replaces the pending Event's payload
+ *  in place, it keeps the position of the first, so the queue length is
+ *  bounded by the number of Widgets rather than by how far the main thread has
+ *  fallen behind. Events stay coalescable until they are taken. */
+class Coalescing_queue : public Lockable<std::mutex> {
+   public:
+    template <typename T>
+    void append(Sequence s, T e)
     {
-        // Allows for send(e) appending to the queue and invalidating iterators.
-        for (auto index = this->get_begin_index(); index != -1uL;
-             index      = this->increment_index(index)) {
-            auto event = this->get_event(index);
-            System::send_event(std::move(event));
+        auto const key  = key_of(e);
+        auto const lock = this->Lockable::lock();
+        if (auto const at = indices_.find(key); at != std::end(indices_))
+            events_[at->second].event = std::move(e);
+        else {
+            indices_.emplace(key, events_.size());
+            events_.push_back({s, std::move(e)});
         }
+    }
+
+    /// Return the position of the oldest pending Event, no_sequence if none.
+    auto front_sequence() -> Sequence
+    {
         auto const lock = this->Lockable::lock();
-        basics_.clear();
+        return front_ == events_.size() ? no_sequence
+                                        : events_[front_].sequence;
+    }
+
+    /// Remove and return the oldest pending Event, if any.
+    auto take_one() -> std::optional<Event>
+    {
+        auto const lock = this->Lockable::lock();
+        if (front_ == events_.size())
+            return std::nullopt;
+        auto e = std::move(events_[front_].event);
+        indices_.erase(std::visit([](auto const& e) { return key_of(e); }, e));
+        if (++front_ == events_.size())
+            this->clear();
+        else if (front_ >= 64uL && front_ * 2uL >= events_.size())
+            this->compact();
+        return e;
+    }
+
+    /// Remove the pending Events that refer to \p w, called when \p w is
+    /// destroyed.
+    void discard(Widget const& w)
+    {
+        auto const lock = this->Lockable::lock();
+        if (!erase_refers_to(events_, front_, w))
+            return;
+        if (front_ == events_.size()) {
+            this->clear();
+            return;
+        }
+        indices_.clear();
+        for (auto i = front_; i < events_.size(); ++i) {
+            indices_.emplace(
+                std::visit([](auto const& e) { return key_of(e); },
+                           events_[i].event),
+                i);
+        }
     }
 
    private:
-    std::vector<Event> basics_;
+    /// Receiver, child (Child_polished_event only), and Event type index.
+    using Key = std::tuple<Widget const*, Widget const*, std::size_t>;
+
+    std::vector<Sequenced_event> events_;
+    std::size_t front_ = 0uL;
+
+    // Map nodes are recycled, guarded by the queue's mutex.
+    std::pmr::unsynchronized_pool_resource index_pool_;
+    std::pmr::map<Key, std::size_t> indices_{&index_pool_};
 
    private:
-    auto get_event(std::size_t index) -> Event
+    void clear()
     {
-        auto const lock = this->Lockable::lock();
-        return std::move(basics_[index]);
+        events_.clear();
+        indices_.clear();
+        front_ = 0uL;
     }
 
-    auto increment_index(std::size_t current) -> std::size_t
+    /// Remove taken Events from the front of events_.
+    void compact()
     {
-        auto const lock = this->Lockable::lock();
-        return current + 1uL < basics_.size() ? current + 1uL : -1uL;
+        events_.erase(std::begin(events_),
+                      std::begin(events_) + static_cast<long>(front_));
+        for (auto& [key, index] : indices_)
+            index -= front_;
+        front_ = 0uL;
     }
 
-    auto get_begin_index() -> std::size_t
+    static auto key_of(Timer_event const& e) -> Key
     {
-        auto const lock = this->Lockable::lock();
-        return basics_.empty() ? -1uL : 0uL;
+        return {std::addressof(e.receiver.get()), nullptr, 0uL};
+    }
+
+    static auto key_of(Resize_event const& e) -> Key
+    {
+        return {std::addressof(e.receiver.get()), nullptr, 1uL};
+    }
+
+    static auto key_of(Move_event const& e) -> Key
+    {
+        return {std::addressof(e.receiver.get()), nullptr, 2uL};
+    }
+
+    static auto key_of(Child_polished_event const& e) -> Key
+    {
+        return {std::addressof(e.receiver.get()), std::addressof(e.child.get()),
+                3uL};
+    }
+
+    /// Never called, only Events with a key are appended.
+    template <typename T>
+    static auto key_of(T const&) -> Key
+    {
+        return {nullptr, nullptr, -1uL};
     }
 };
 
 class Event_queue {
    public:
-    /// Adds the given event with priority for the concrete event type.
+    using Clock_t = std::chrono::steady_clock;
+
+   public:
+    /// Adds the given event to the queue for the concrete event type.
     void append(Event e)
     {
+        auto const s = next_sequence_.fetch_add(1uL, std::memory_order_relaxed);
         std::visit(
-            [this](auto&& e) {
-                this->add_to_a_queue(std::forward<decltype(e)>(e));
+            [this, s](auto&& e) {
+                this->add_to_a_queue(s, std::forward<decltype(e)>(e));
             },
             std::move(e));
     }
 
-    void send_all()
+    /// Remove every pending Event that refers to \p w.
+    /** Called when \p w is destroyed, possibly while send_all() is running,
+     *  so nothing is sent to \p w after its destructor. Delete_events are
+     *  not affected. Main thread only. */
+    void discard(Widget& w)
+    {
+        if (w.needs_paint().load())
+            paints_.discard_paint(w);
+        geometry_.discard(w);
+        timers_.discard(w);
+        erase_refers_to(pending_, front_, w);
+        erase_refers_to(postponed_, 0uL, w);
+    }
+
+    /// Hold geometry, child and paint Events until the outermost end_batch().
+    /** Batches nest. See System::Batch. */
+    void begin_batch() { batch_depth_.fetch_add(1uL); }
+
+    /// End the innermost batch, the outermost sends the held Events.
+    /** The held Events are sent while the batch is still counted, so Events
+     *  posted by their handlers are held and sent too, and Layouts defer their
+     *  layout passes until every held Event has been sent. */
+    void end_batch()
+    {
+        if (batch_depth_.load() == 1uL) {
+            auto const send = [this](Event e) {
+                if (auto* const paint = std::get_if<Paint_event>(&e))
+                    paints_.append(std::move(*paint));
+                else
+                    System::send_event(std::move(e));
+            };
+            while (held_.consume_segment(send) != 0uL) {
+            }
+        }
+        if (batch_depth_.fetch_sub(1uL) != 1uL)
+            return;
+        for (auto i = 0uL; i < deferred_.size(); ++i) {
+            if (auto const [w, update] = deferred_[i]; w != nullptr)
+                update(*w);
+        }
+        deferred_.clear();
+    }
+
+    /// Return true while a batch is alive or its held Events are being sent.
+    auto is_batching() const -> bool { return batch_depth_.load() != 0uL; }
+
+    /// Call \p update with \p w after the outermost batch has ended.
+    void defer_layout(Widget& w, void (*update)(Widget&))
+    {
+        deferred_.push_back({&w, update});
+    }
+
+    /// Forget the deferred layout of \p w, called when \p w is destroyed.
+    void cancel_layout(Widget& w)
+    {
+        for (auto& [widget, update] : deferred_) {
+            if (widget == &w)
+                widget = nullptr;
+        }
+    }
+
+    /// Send queued Events in the order posted, then paint, then delete.
+    /** Coalesced Events are sent at the position of the first of them posted.
+     *  Every Event is sent except Timer and Custom Events, which are left for
+     *  the next call once \p deadline has passed, though at least one is sent
+     *  per call so they are never starved. Custom Events left for the next
+     *  call are sent first on that call. */
+    void send_all(Clock_t::time_point deadline)
     {
-        basics_.send_all();
+        auto sent_deferrable   = false;
+        auto const over_budget = [&] {
+            return sent_deferrable && Clock_t::now() >= deadline;
+        };
+        while (true) {
+            if (front_ == pending_.size())
+                this->take_basics();
+            auto const basic = front_ == pending_.size()
+                                   ? no_sequence
+                                   : pending_[front_].sequence;
+            if (geometry_.front_sequence() < basic) {
+                System::send_event(*geometry_.take_one());
+                continue;
+            }
+            if (basic != no_sequence) {
+                auto& next = pending_[front_++];
+                if (std::holds_alternative<Custom_event>(next.event)) {
+                    if (over_budget()) {
+                        postponed_.push_back(std::move(next));
+                        continue;
+                    }
+                    sent_deferrable = true;
+                }
+                System::send_event(std::move(next.event));
+                continue;
+            }
+            if (over_budget())
+                break;
+            auto timer = timers_.take_one();
+            if (!timer.has_value())
+                break;
+            System::send_event(std::move(*timer));
+            sent_deferrable = true;
+        }
+        std::swap(pending_, postponed_);
+        postponed_.clear();
+        front_ = 0uL;
         paints_.send_all();
         deletes_.send_all();
     }
 
    private:
+    std::atomic<Sequence> next_sequence_ = 0uL;
     Basic_queue basics_;
+    Coalescing_queue geometry_;
+    Coalescing_queue timers_;
     Paint_queue paints_;
     Delete_queue deletes_;
 
+    // Held Events and deferred layouts, see System::Batch.
+    std::atomic<std::size_t> batch_depth_ = 0uL;
+    MPSC_queue<Event> held_;
+    std::vector<std::pair<Widget*, void (*)(Widget&)>> deferred_;
+
+    // Basic Events taken from basics_ and not yet sent, main thread only.
+    std::vector<Sequenced_event> pending_;
+    std::vector<Sequenced_event> postponed_;
+    std::size_t front_ = 0uL;
+
    private:
+    /// Replace the sent pending_ Events with the basic Events posted since.
+    void take_basics()
+    {
+        pending_.clear();
+        front_ = 0uL;
+        if (!this->is_batching()) {
+            // Held by another thread just as the outermost batch ended.
+            held_.consume_segment(
+                [this](Event e) { this->append(std::move(e)); });
+        }
+        basics_.take_all(
+            [this](Sequenced_event e) { pending_.push_back(std::move(e)); });
+    }
+
     template <typename T>
-    void add_to_a_queue(T e)
+    void add_to_a_queue(Sequence s, T e)
+    {
+        basics_.append(s, std::move(e));
+    }
+
+    void add_to_a_queue(Sequence s, Timer_event e)
+    {
+        timers_.append(s, std::move(e));
+    }
+
+    void add_to_a_queue(Sequence s, Resize_event e)
+    {
+        if (!this->hold(e))
+            geometry_.append(s, std::move(e));
+    }
+
+    void add_to_a_queue(Sequence s, Move_event e)
     {
-        basics_.append(std::move(e));
+        if (!this->hold(e))
+            geometry_.append(s, std::move(e));
     }
 
-    void add_to_a_queue(Paint_event e) { paints_.append(std::move(e)); }
+    void add_to_a_queue(Sequence s, Child_added_event e)
+    {
+        if (!this->hold(e))
+            basics_.append(s, std::move(e));
+    }
+
+    void add_to_a_queue(Sequence s, Child_removed_event e)
+    {
+        if (!this->hold(e))
+            basics_.append(s, std::move(e));
+    }
 
-    void add_to_a_queue(Delete_event e) { deletes_.append(std::move(e)); }
+    void add_to_a_queue(Sequence s, Child_polished_event e)
+    {
+        if (!this->hold(e))
+            geometry_.append(s, std::move(e));
+    }
+
+    void add_to_a_queue(Sequence, Paint_event e)
+    {
+        if (!this->hold(e))
+            paints_.append(std::move(e));
+    }
+
+    void add_to_a_queue(Sequence, Delete_event e)
+    {
+        deletes_.append(std::move(e));
+    }
+
+    /// Append \p e to held_ and return true if a batch is alive.
+    template <typename T>
+    auto hold(T& e) -> bool
+    {
+        if (!this->is_batching())
+            return false;
+        held_.push(std::move(e));
+        return true;
+    }
 };
 
 }  // namespace ox::detail
@@ -11,8 +11,8 @@ namespace ox::detail {
 /// Applies \p filter_function over \p filters, up until it returns true.
 /** If none return true, then this returns false. */
 template <typename F>
-auto apply_until_accepted(F&& filter_function, std::set<Widget*> const& filters)
-    -> bool
+auto apply_until_accepted(F&& filter_function,
+                          Widget::Event_filters_t const& filters) -> bool
 {
     return std::find_if(std::begin(filters), std::end(filters),
                         filter_function) != std::end(filters);
@@ -188,7 +188,19 @@ inline auto filter_send(ox::Timer_event const& e) -> bool
 
 inline auto filter_send(ox::Custom_event const& e) -> bool
 {
-    return e.filter_send();
+    return e.filter_send != nullptr && e.filter_send();
+}
+
+/// Return false if \p e cannot have any filters, so filter_send can be skipped.
+template <typename T>
+auto has_filter_stage(T const&) -> bool
+{
+    return Widget::installed_filter_count() != 0uL;
+}
+
+inline auto has_filter_stage(ox::Custom_event const& e) -> bool
+{
+    return e.filter_send != nullptr;
 }
 
 }  // namespace ox::detail
@@ -12,7 +12,8 @@ namespace ox::detail {
 /** Return nullptr on failing to find a Widget with the provided coordinates.
  *  Return the deepest child Widget that owns the coordinates. If a parent owns
  *  the coordinates, it is checked if any of the children own it as well before
- *  returning. Used only by input::get at the moment. */
+ *  returning. Of overlapping siblings, the later, topmost one is returned.
+ *  Scans Render_list::current(). Used only by input::get at the moment. */
 auto find_widget_at(Point p) -> Widget*;
 
 }  // namespace ox::detail
@@ -41,6 +41,11 @@ class Focus {
     /// Re-enable a Tab or Back_tab to change focus to the next Widget.
     static void unsuppress_tab() { tab_suppressed_ = false; }
 
+    /// Rebuild the Tab order on the next Tab or Back_tab press.
+    /** Called when the Widget tree, the head Widget, an enabled state or a
+     *  focus_policy changes. */
+    static void invalidate_tab_chain();
+
     /// Directly sets the focus widget without sending any events.
     /** Only for use by send(Focus_in_event). */
     static void direct_set_focus(ox::Widget& w) { focus_widget_ = &w; }
@@ -0,0 +1,30 @@
+#ifndef TERMOX_SYSTEM_DETAIL_FRAME_ARENA_HPP
+#define TERMOX_SYSTEM_DETAIL_FRAME_ARENA_HPP
+#include <memory_resource>
+
+namespace ox::detail {
+
+/// Scratch memory for temporaries that do not outlive the current frame.
+/** While the Event_engine is processing a frame, resource() on its thread is a
+ *  monotonic buffer that is released after the screen is flushed. The buffer
+ *  at least doubles when a frame overflows it, so steady state frames do not
+ *  touch the heap. Outside of a frame, or on any other thread, resource() is
+ *  the heap. Only use for locals, never for anything stored past the current
+ *  event, debug builds assert at the end of the frame that every allocation
+ *  from the buffer has been deallocated. */
+class Frame_arena {
+   public:
+    /// Return the memory resource for frame lifetime allocations.
+    static auto resource() -> std::pmr::memory_resource*;
+
+    /// Direct resource() on the calling thread to the frame buffer.
+    /** Called by the Event_engine at the start of each frame. */
+    static void begin_frame();
+
+    /// Release everything allocated since begin_frame().
+    /** Called by the Event_engine after each flush. */
+    static void end_frame();
+};
+
+}  // namespace ox::detail
+#endif  // TERMOX_SYSTEM_DETAIL_FRAME_ARENA_HPP
@@ -1,8 +1,6 @@
 #ifndef TERMOX_SYSTEM_DETAIL_INTERVAL_EVENT_LOOP_HPP
 #define TERMOX_SYSTEM_DETAIL_INTERVAL_EVENT_LOOP_HPP
-#include <algorithm>
 #include <chrono>
-#include <thread>
 
 #include <termox/system/event_loop.hpp>
 
@@ -43,38 +41,20 @@ class Interval_event_loop : public Event_loop {
 
    protected:
     /// Tells the event engine to not processes the event queue.
-    /** The first call to this method returns immediately. */
+    /** The first call to this method returns immediately. Returns as soon as
+     *  exit() is called, rather than at the end of the interval. */
     void loop_function() override
     {
-        auto leftovers = this->get_actual_interval();
-        while (leftovers > exit_check_interval_) {
-            if (this->Event_loop::exit_flag())
-                return;
-            std::this_thread::sleep_for(exit_check_interval_);
-            leftovers -= exit_check_interval_;
-        }
-        std::this_thread::sleep_for(leftovers);
+        if (this->Event_loop::sleep_until(last_time_ + interval_))
+            return;
         last_time_ = Clock_t::now();  // Don't have to update if you are exiting
     }
 
    private:
-    using Clock_t = std::chrono::high_resolution_clock;
+    using Clock_t = std::chrono::steady_clock;
 
     Period_t const interval_;
     std::chrono::time_point<Clock_t> last_time_;
-
-    static auto constexpr exit_check_interval_ = Period_t{30};
-
-   private:
-    /// Return the interval, minus the time since the last loop finished.
-    /** Returns zero if the time elapsed since the last loop is larger than the
-     *  set interval. Starting, then stopping, then starting again, will do the
-     *  right thing. Returns zero on the first call. */
-    auto get_actual_interval() const -> Clock_t::duration
-    {
-        auto const elapsed = Clock_t::now() - last_time_;
-        return std::max(Clock_t::duration::zero(), interval_ - elapsed);
-    }
 };
 
 }  // namespace ox::detail
@@ -1,6 +1,7 @@
 #ifndef TERMOX_SYSTEM_DETAIL_SEND_HPP
 #define TERMOX_SYSTEM_DETAIL_SEND_HPP
 #include <termox/painter/detail/is_paintable.hpp>
+#include <termox/painter/detail/render_list.hpp>
 #include <termox/system/detail/focus.hpp>
 #include <termox/system/event.hpp>
 #include <termox/system/key.hpp>
@@ -66,14 +67,14 @@ inline void send(ox::Child_polished_event e)
     e.receiver.get().child_polished_event(e.child);
 }
 
-inline void send(ox::Delete_event e)
+/// Returns the removed Widget, so the caller decides when to destroy it.
+inline auto send(ox::Delete_event e) -> std::unique_ptr<Widget>
 {
     if (e.removed == nullptr)
-        return;
+        return nullptr;
     e.removed->delete_event();
-    for (Widget* w : e.removed->get_descendants())
-        w->delete_event();
-    e.removed.reset();
+    e.removed->for_each_descendant([](Widget& w) { w.delete_event(); });
+    return std::move(e.removed);
 }
 
 inline void send(ox::Disable_event e)
@@ -101,6 +102,7 @@ inline void send(ox::Move_event e)
     e.receiver.get().screen_state().clear();
     e.receiver.get().screen_state().move(new_position);
     e.receiver.get().set_top_left(new_position);
+    Render_list::invalidate();
     e.receiver.get().move_event(new_position, old_position);
 }
 
@@ -111,7 +113,10 @@ inline void send(ox::Resize_event e)
     if (old_area == new_area)
         return;
     e.receiver.get().set_outer_area(new_area);
+    Render_list::invalidate();
     e.receiver.get().screen_state().resize(new_area);
+    if (e.receiver.get().is_animated())
+        System::animation_engine().update_visibility(e.receiver);
     e.receiver.get().resize_event(new_area, old_area);
 }
 
@@ -4,6 +4,7 @@
 #include <memory>
 #include <variant>
 
+#include <termox/common/inplace_function.hpp>
 #include <termox/system/key.hpp>
 #include <termox/system/mouse.hpp>
 #include <termox/widget/area.hpp>
@@ -100,10 +101,13 @@ struct Timer_event {
 /** \p send will be called to send the event, typically would call on a member
  *  function of some receiving Widget type. \p filter_send should call whatever
  *  filter method on each installed filter, and return true if one of the
- *  filters handled the event. */
+ *  filters handled the event; it can be left empty if there are no filters.
+ *  \p send stores captures of up to three pointers in place, \p filter_send
+ *  up to one, larger captures compile and are heap allocated. Both must be
+ *  copy constructible, as they were when these were std::functions. */
 struct Custom_event {
-    std::function<void()> send;
-    std::function<bool()> filter_send = [] { return false; };
+    Inplace_function<void(), 3 * sizeof(void*)> send;
+    Inplace_function<bool(), sizeof(void*)> filter_send = nullptr;
 };
 
 using Event = std::variant<Paint_event,
@@ -126,5 +130,9 @@ using Event = std::variant<Paint_event,
                            Timer_event,
                            Custom_event>;
 
+// Events are moved through the queues by value, keep them a few words large.
+static_assert(sizeof(Event) <= 7 * sizeof(void*),
+              "ox::Event has grown, is a large member stored in place?");
+
 }  // namespace ox
 #endif  // TERMOX_SYSTEM_EVENT_HPP
@@ -1,7 +1,10 @@
 #ifndef TERMOX_SYSTEM_EVENT_LOOP_HPP
 #define TERMOX_SYSTEM_EVENT_LOOP_HPP
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <future>
+#include <mutex>
 #include <stdexcept>
 #include <thread>
 #include <utility>
@@ -41,8 +44,12 @@ class Event_loop {
      *  valid to call once per call to run(). */
     void exit(int return_code)
     {
-        return_code_ = return_code;
-        exit_        = true;
+        {
+            auto const lock = std::scoped_lock{exit_mtx_};
+            return_code_    = return_code;
+            exit_           = true;
+        }
+        exit_requested_.notify_all();
     }
 
     /// Block until the async event loop returns.
@@ -58,6 +65,17 @@ class Event_loop {
     /// Return true if the exit flag has been set.
     auto exit_flag() const -> bool { return exit_; }
 
+    /// Block until \p deadline, returning early if exit() is called.
+    /** Returns true if woken by exit(). Does not poll, so an idle loop does
+     *  not wake before \p deadline. */
+    template <typename Clock, typename Duration>
+    auto sleep_until(std::chrono::time_point<Clock, Duration> deadline) -> bool
+    {
+        auto lock = std::unique_lock{exit_mtx_};
+        return exit_requested_.wait_until(lock, deadline,
+                                          [this] { return exit_.load(); });
+    }
+
    private:
     /// Connect to the System::exit_signal so loop can exit with System.
     auto connect_to_system_exit() -> void;
@@ -68,6 +86,8 @@ class Event_loop {
     int return_code_        = 0;
     bool running_           = false;
     std::atomic<bool> exit_ = false;
+    std::mutex exit_mtx_;
+    std::condition_variable exit_requested_;
 
    protected:
     bool is_main_thread_ = false;
@@ -0,0 +1,63 @@
+#ifndef TERMOX_SYSTEM_FRAME_CLOCK_HPP
+#define TERMOX_SYSTEM_FRAME_CLOCK_HPP
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ox {
+
+/// Calls registered callbacks once per rendered frame, just before painting.
+/** A frame is one Event_engine::process() call, so callbacks run on the main
+ *  thread in phase with the screen flush, and any update() they make is
+ *  painted in the same frame. Without input, frames happen at the Terminal's
+ *  refresh rate. Should only be used from the main thread. */
+class Frame_clock {
+   public:
+    using Clock_t    = std::chrono::steady_clock;
+    using Duration_t = Clock_t::duration;
+    using Callback_t = std::function<void(Duration_t)>;
+
+    /// Identifies a callback for removal, zero is never a valid Id.
+    using Id = std::uint64_t;
+
+   public:
+    /// Call \p fn every frame with the time elapsed since the previous frame.
+    /** If called from within a callback, \p fn first runs on the next frame. */
+    auto on_frame(Callback_t fn) -> Id;
+
+    /// Stop calling the callback identified by \p id.
+    /** No-op if \p id is not registered, safe to call from within a callback,
+     *  including the callback being removed. */
+    void remove(Id id);
+
+    /// Return true if any callbacks are registered.
+    auto is_active() const -> bool
+    {
+        return !callbacks_.empty() || !added_.empty();
+    }
+
+    /// Return the time of the current, or most recently processed, frame.
+    auto frame_time() const -> Clock_t::time_point { return last_frame_; }
+
+    /// Begin a new frame at \p now, calling each registered callback.
+    /** Called by the Event_engine before Events are sent each frame. */
+    void tick(Clock_t::time_point now);
+
+   private:
+    struct Entry {
+        Id id;  // Zero once removed.
+        Callback_t fn;
+    };
+
+    std::vector<Entry> callbacks_;
+    // Callbacks added during tick(), they can't be appended to callbacks_
+    // while one of its elements is being called.
+    std::vector<Entry> added_;
+    Clock_t::time_point last_frame_ = Clock_t::now();
+    Id next_id_                     = 1;
+    bool is_ticking_                = false;
+};
+
+}  // namespace ox
+#endif  // TERMOX_SYSTEM_FRAME_CLOCK_HPP
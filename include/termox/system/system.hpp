@@ -1,5 +1,6 @@
 #ifndef TERMOX_SYSTEM_SYSTEM_HPP
 #define TERMOX_SYSTEM_SYSTEM_HPP
+#include <memory>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -12,6 +13,8 @@
 
 namespace ox {
 class Animation_engine;
+class Frame_clock;
+class Thread_pool;
 class Widget;
 }  // namespace ox
 
@@ -103,8 +106,10 @@ class System {
     // Minor optimization.
     static void send_event(Paint_event e);
 
-    // Minor optimization.
-    static void send_event(Delete_event e);
+    /// Send to filters and the removed Widget and its descendants.
+    /** Returns the removed Widget, it is destroyed immediately if discarded.
+     *  Posted Delete_events are instead destroyed together at end of frame. */
+    static auto send_event(Delete_event e) -> std::unique_ptr<Widget>;
 
     /// Append the event to the Event_queue for the thread it was called on.
     /** The Event_queue is processed once per iteration of the Event_loop. When
@@ -112,6 +117,47 @@ class System {
      *  System::send_event() */
     static void post_event(Event e);
 
+    /// Coalesces layout work for Widget changes made while it is alive.
+    /** While any Batch exists, posted Resize, Move, Child_added,
+     *  Child_removed, Child_polished and Paint Events are held rather than
+     *  queued. When the outermost Batch ends the held Events are sent in the
+     *  order posted, with each Layout recording that it needs a layout pass
+     *  instead of running one, then each of those Layouts is laid out once.
+     *  Should only be used from the main thread, within one event handler. */
+    class Batch {
+       public:
+        Batch();
+        ~Batch();
+
+        Batch(Batch const&) = delete;
+        Batch(Batch&&)      = delete;
+        auto operator=(Batch const&) -> Batch& = delete;
+        auto operator=(Batch&&) -> Batch& = delete;
+
+       public:
+        /// Return true while a Batch exists or its held Events are being sent.
+        static auto is_active() -> bool;
+
+        /// Call \p update with \p w once the outermost Batch has ended.
+        /** Used by Layout to defer update_geometry(). \p w must only be
+         *  deferred once per Batch, and must be cancelled if destroyed. */
+        static void defer(Widget& w, void (*update)(Widget&));
+
+        /// Forget the deferred call for \p w, if any.
+        static void cancel(Widget& w);
+    };
+
+    /// Call \p fn within a Batch, returns whatever \p fn returns.
+    /** For instance, filling a table:
+     *  System::batch([&] { for (auto& r : rows) table.make_child<Row>(r); });
+     */
+    template <typename F>
+    static auto batch(F&& fn) -> decltype(auto)
+    {
+        auto const b = Batch{};
+        return std::forward<F>(fn)();
+    }
+
     /// Send an exit signal to each of the currently running Event_loops.
     /** Also call shutdown() on the Animation_engine and set
      *  System::exit_requested_ to true. Though it sends the exit signal to each
@@ -132,6 +178,13 @@ class System {
         return animation_engine_;
     }
 
+    /// Return a reference to the Frame_clock in System.
+    /** Calls registered callbacks once per frame, just before painting. */
+    static auto frame_clock() -> Frame_clock& { return frame_clock_; }
+
+    /// Return the Thread_pool used by ox::async(), started on first use.
+    static auto thread_pool() -> Thread_pool&;
+
     /// Return whether System has gotten an exit request, set by System::exit()
     static auto exit_requested() -> bool { return exit_requested_; }
 
@@ -141,6 +194,7 @@ class System {
     static detail::User_input_event_loop user_input_loop_;
     static detail::Event_engine event_engine_;
     static Animation_engine animation_engine_;
+    static Frame_clock frame_clock_;
 };
 
 }  // namespace ox
@@ -0,0 +1,56 @@
+#ifndef TERMOX_SYSTEM_THREAD_POOL_HPP
+#define TERMOX_SYSTEM_THREAD_POOL_HPP
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ox {
+
+/// Fixed number of worker threads running submitted tasks in FIFO order.
+/** System::thread_pool() is shared by ox::async(), a separate pool can be
+ *  constructed for work that should not compete with it. */
+class Thread_pool {
+   public:
+    using Task_t = std::function<void()>;
+
+   public:
+    /// Start \p thread_count worker threads, at least one is started.
+    explicit Thread_pool(std::size_t thread_count = default_size());
+
+    Thread_pool(Thread_pool const&) = delete;
+    Thread_pool(Thread_pool&&)      = delete;
+    auto operator=(Thread_pool const&) -> Thread_pool& = delete;
+    auto operator=(Thread_pool&&) -> Thread_pool& = delete;
+
+    /// Waits for running tasks, tasks not yet started are discarded.
+    ~Thread_pool();
+
+   public:
+    /// Queue \p task to run on one of the worker threads.
+    void submit(Task_t task);
+
+    /// Return the number of worker threads.
+    auto size() const -> std::size_t { return workers_.size(); }
+
+    /// One less than the hardware concurrency, leaving a core for the UI.
+    /** At least one, also when the hardware concurrency is unknown. */
+    static auto default_size() -> std::size_t;
+
+   private:
+    std::vector<std::thread> workers_;
+    std::deque<Task_t> tasks_;
+    std::mutex mtx_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+
+   private:
+    /// Worker thread body, runs until stop_ is set.
+    void run();
+};
+
+}  // namespace ox
+#endif  // TERMOX_SYSTEM_THREAD_POOL_HPP
@@ -0,0 +1,107 @@
+#ifndef TERMOX_SYSTEM_TIMER_SCHEDULER_HPP
+#define TERMOX_SYSTEM_TIMER_SCHEDULER_HPP
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ox {
+
+/// Runs callbacks at deadlines on a single, shared background thread.
+/** Serves every animated Widget, every dynamic color and any user timers, so
+ *  the thread count does not grow with the number of distinct periods. The
+ *  thread sleeps until the earliest deadline, it does not poll. Callbacks added
+ *  with add_one_shot() and add_repeating() run on the scheduler thread and
+ *  should be quick, typically posting an Event. Use post_after() and
+ *  post_every() to have a callback run on the main thread instead. */
+class Timer_scheduler {
+   public:
+    using Clock_t    = std::chrono::steady_clock;
+    using Period_t   = std::chrono::milliseconds;
+    using Callback_t = std::function<void()>;
+
+    /// Identifies a timer for cancellation, zero is never a valid Id.
+    using Id = std::uint64_t;
+
+   public:
+    /// Return the single Timer_scheduler, constructed on first use.
+    static auto get() -> Timer_scheduler&;
+
+    Timer_scheduler() = default;
+
+    Timer_scheduler(Timer_scheduler const&) = delete;
+    Timer_scheduler(Timer_scheduler&&)      = delete;
+    auto operator=(Timer_scheduler const&) -> Timer_scheduler& = delete;
+    auto operator=(Timer_scheduler&&) -> Timer_scheduler& = delete;
+
+    /// Stops and joins the scheduler thread.
+    ~Timer_scheduler();
+
+   public:
+    /// Call \p fn once on the scheduler thread after \p delay.
+    auto add_one_shot(Period_t delay, Callback_t fn) -> Id;
+
+    /// Call \p fn on the scheduler thread every \p period, first in \p period.
+    /** Deadlines do not drift with callback run time. If the thread falls more
+     *  than a period behind, missed calls are skipped rather than bunched. */
+    auto add_repeating(Period_t period, Callback_t fn) -> Id;
+
+    /// Call \p fn once on the main thread after \p delay.
+    /** \p fn is posted as a Custom_event, it does not need a Widget. */
+    auto post_after(Period_t delay, Callback_t fn) -> Id;
+
+    /// Call \p fn on the main thread every \p period.
+    /** Each call is posted as a Custom_event, it does not need a Widget. */
+    auto post_every(Period_t period, Callback_t fn) -> Id;
+
+    /// Stop the timer identified by \p id, no-op if it is no longer active.
+    /** A callback already running on the scheduler thread finishes, and an
+     *  already posted Custom_event is still sent, there are no calls after. */
+    void cancel(Id id);
+
+   private:
+    struct Timer {
+        Period_t period;
+        bool repeats;
+        std::shared_ptr<Callback_t> fn;
+    };
+
+    struct Deadline {
+        Clock_t::time_point when;
+        Id id;
+    };
+
+    struct Is_later {
+        auto operator()(Deadline const& x, Deadline const& y) const -> bool
+        {
+            return x.when > y.when;
+        }
+    };
+
+    // Cancelled timers are only erased from timers_, their stale Deadline is
+    // discarded when it reaches the top of deadlines_.
+    std::unordered_map<Id, Timer> timers_;
+    std::priority_queue<Deadline, std::vector<Deadline>, Is_later> deadlines_;
+    Id next_id_ = 1;
+
+    std::mutex mtx_;
+    std::condition_variable wake_;
+    std::thread thread_;
+    bool stop_ = false;
+
+   private:
+    auto add(Period_t delay, Period_t period, bool repeats, Callback_t fn)
+        -> Id;
+
+    /// Scheduler thread body, runs until stop_ is set.
+    void run();
+};
+
+}  // namespace ox
+#endif  // TERMOX_SYSTEM_TIMER_SCHEDULER_HPP
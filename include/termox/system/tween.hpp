@@ -0,0 +1,183 @@
+#ifndef TERMOX_SYSTEM_TWEEN_HPP
+#define TERMOX_SYSTEM_TWEEN_HPP
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <signals_light/signal.hpp>
+
+#include <termox/painter/color.hpp>
+#include <termox/system/frame_clock.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+
+namespace ox::easing {
+
+/// Easing curves, each maps progress in [0, 1] to [0, 1], fixing both ends.
+using Curve_t = double (*)(double);
+
+inline auto linear(double t) -> double { return t; }
+
+inline auto in_quad(double t) -> double { return t * t; }
+
+inline auto out_quad(double t) -> double { return t * (2. - t); }
+
+inline auto in_out_quad(double t) -> double
+{
+    return t < 0.5 ? 2. * t * t : -1. + (4. - 2. * t) * t;
+}
+
+inline auto in_cubic(double t) -> double { return t * t * t; }
+
+inline auto out_cubic(double t) -> double
+{
+    auto const u = t - 1.;
+    return u * u * u + 1.;
+}
+
+inline auto in_out_cubic(double t) -> double
+{
+    if (t < 0.5)
+        return 4. * t * t * t;
+    auto const u = 2. * t - 2.;
+    return 0.5 * u * u * u + 1.;
+}
+
+inline auto in_out_sine(double t) -> double
+{
+    return 0.5 * (1. - std::cos(3.14159265358979323846 * t));
+}
+
+}  // namespace ox::easing
+
+namespace ox {
+
+/// Return the value \p t of the way from \p from to \p to, \p t in [0, 1].
+/** Integral results are rounded to the nearest value. */
+template <typename T,
+          typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+auto interpolate(T from, T to, double t) -> T
+{
+    auto const x = static_cast<double>(from) +
+                   (static_cast<double>(to) - static_cast<double>(from)) * t;
+    if constexpr (std::is_integral_v<T>)
+        return static_cast<T>(std::lround(x));
+    else
+        return static_cast<T>(x);
+}
+
+inline auto interpolate(Point from, Point to, double t) -> Point
+{
+    return {interpolate(from.x, to.x, t), interpolate(from.y, to.y, t)};
+}
+
+inline auto interpolate(Area from, Area to, double t) -> Area
+{
+    return {interpolate(from.width, to.width, t),
+            interpolate(from.height, to.height, t)};
+}
+
+/// Interpolates each of the red, green and blue components.
+inline auto interpolate(True_color from, True_color to, double t) -> True_color
+{
+    return RGB{interpolate(from.red(), to.red(), t),
+               interpolate(from.green(), to.green(), t),
+               interpolate(from.blue(), to.blue(), t)};
+}
+
+/// Animates a value from one end point to another over a fixed duration.
+/** Runs on the System's Frame_clock, the interpolated value is passed to the
+ *  apply function once per frame. Stops after the final value is applied, and
+ *  when destroyed. Any type with an interpolate(T, T, double) overload can be
+ *  tweened. Should only be used from the main thread. */
+template <typename T>
+class Tween {
+   public:
+    using Duration_t = Frame_clock::Duration_t;
+
+    /// Emitted once the final value has been applied.
+    sl::Signal<void()> finished;
+
+   public:
+    /// Create a stopped Tween, \p apply is given each interpolated value.
+    Tween(T from,
+          T to,
+          Duration_t duration,
+          std::function<void(T const&)> apply,
+          easing::Curve_t curve = easing::linear)
+        : from_{std::move(from)},
+          to_{std::move(to)},
+          duration_{duration},
+          apply_{std::move(apply)},
+          curve_{curve}
+    {}
+
+    Tween(Tween const&) = delete;
+    Tween(Tween&&)      = delete;
+    auto operator=(Tween const&) -> Tween& = delete;
+    auto operator=(Tween&&) -> Tween& = delete;
+
+    ~Tween() { this->stop(); }
+
+   public:
+    /// Begin from the start value, restarts if already running.
+    void start()
+    {
+        this->stop();
+        start_time_ = System::frame_clock().frame_time();
+        id_         = System::frame_clock().on_frame(
+            [this](Duration_t) { this->step(); });
+    }
+
+    /// Set new end points, takes effect on the next start().
+    void set_range(T from, T to)
+    {
+        from_ = std::move(from);
+        to_   = std::move(to);
+    }
+
+    /// Stop at the currently applied value, finished is not emitted.
+    void stop()
+    {
+        if (id_ == 0)
+            return;
+        System::frame_clock().remove(id_);
+        id_ = 0;
+    }
+
+    /// Return true if the Tween has been started and has not yet finished.
+    auto is_running() const -> bool { return id_ != 0; }
+
+   private:
+    T from_;
+    T to_;
+    Duration_t duration_;
+    std::function<void(T const&)> apply_;
+    easing::Curve_t curve_;
+    Frame_clock::Clock_t::time_point start_time_;
+    Frame_clock::Id id_ = 0;
+
+   private:
+    /// Apply the value for the current frame, stopping at the end.
+    void step()
+    {
+        auto const elapsed = System::frame_clock().frame_time() - start_time_;
+        auto const t =
+            duration_.count() <= 0
+                ? 1.
+                : std::min(1., std::chrono::duration<double>(elapsed) /
+                                   std::chrono::duration<double>(duration_));
+        apply_(interpolate(from_, to_, curve_(t)));
+        if (t < 1.)
+            return;
+        this->stop();
+        finished();
+    }
+};
+
+}  // namespace ox
+#endif  // TERMOX_SYSTEM_TWEEN_HPP
@@ -8,6 +8,7 @@
 #include <termox/painter/color.hpp>
 #include <termox/painter/glyph.hpp>
 #include <termox/terminal/dynamic_color_engine.hpp>
+#include <termox/widget/area.hpp>
 
 namespace ox {
 
@@ -14,9 +14,14 @@
 #include <termox/system/mouse.hpp>
 
 #include <termox/system/animation_engine.hpp>
+#include <termox/system/async.hpp>
+#include <termox/system/binding.hpp>
 #include <termox/system/event_loop.hpp>
+#include <termox/system/frame_clock.hpp>
 #include <termox/system/shortcuts.hpp>
 #include <termox/system/system.hpp>
+#include <termox/system/thread_pool.hpp>
+#include <termox/system/tween.hpp>
 
 #include <termox/terminal/input.hpp>
 #include <termox/terminal/output.hpp>
@@ -55,6 +60,7 @@
 #include <termox/widget/point.hpp>
 #include <termox/widget/size_policy.hpp>
 #include <termox/widget/widget.hpp>
+#include <termox/widget/widget_arena.hpp>
 #include <termox/widget/widget_slots.hpp>
 
 #endif  // TERMOX_HPP
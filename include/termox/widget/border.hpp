@@ -14,10 +14,10 @@ class Border {
         Segment(Glyph g) : Glyph{g} {}
 
         /// Enable the Segment to be displayable.
-        void enable() { enabled_ = true; }
+        void enable();
 
         /// Disable the Segment, making it non-displayable.
-        void disable() { enabled_ = false; }
+        void disable();
 
         /// Return whether or not the border is enabled.
         auto enabled() const -> bool { return enabled_; }
@@ -68,10 +68,10 @@ class Border {
     /// Enable the Border.
     /** This will give it space within its Widget and make it displayable.
      *  Segments are only displayed if their Border is enabled. */
-    void enable() { enabled_ = true; }
+    void enable();
 
     /// Disable the Border.
-    void disable() { enabled_ = false; }
+    void disable();
 
     /// Return whether the border is enabled.
     auto enabled() const -> bool { return enabled_; }
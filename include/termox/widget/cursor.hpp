@@ -2,8 +2,7 @@
 #define TERMOX_WIDGET_CURSOR_DATA_HPP
 #include <cstddef>
 
-#include <signals_light/signal.hpp>
-
+#include <termox/widget/detail/lazy_signal.hpp>
 #include <termox/widget/point.hpp>
 
 namespace ox {
@@ -13,7 +12,7 @@ class Widget;
 class Cursor {
    public:
     /// Signal called when the cursor is moved, passing along the new position.
-    sl::Signal<void(Point)> moved;
+    detail::Lazy_signal<void(Point)> moved;
 
    public:
     /// Query if the cursor is enabled.
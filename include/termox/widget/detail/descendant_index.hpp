@@ -0,0 +1,98 @@
+#ifndef TERMOX_WIDGET_DETAIL_DESCENDANT_INDEX_HPP
+#define TERMOX_WIDGET_DETAIL_DESCENDANT_INDEX_HPP
+#include <cstddef>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include <termox/common/small_vector.hpp>
+#include <termox/widget/widget.hpp>
+
+namespace ox::detail {
+
+/// Lookup of a Widget's descendants by name and by dynamic type.
+/** Owned by the Widget it indexes, see Widget::enable_descendant_index(). Kept
+ *  up to date by Layout as children are inserted and removed, and by
+ *  Widget::set_name(). Widgets with an empty name are not indexed by name.
+ *  Main thread only, like the Widget tree itself. */
+class Descendant_index {
+   public:
+    using Bucket_t  = std::vector<Widget*>;
+    using Buckets_t = Small_vector<Bucket_t const*, 8>;
+
+   public:
+    /// Index every current descendant of \p owner.
+    explicit Descendant_index(Widget& owner);
+
+    Descendant_index(Descendant_index const&) = delete;
+    auto operator=(Descendant_index const&) -> Descendant_index& = delete;
+
+    ~Descendant_index();
+
+   public:
+    /// Return the Widgets named \p name, in insertion order, nullptr if none.
+    auto named(std::string const& name) const -> Bucket_t const*;
+
+    /// Return each bucket of Widgets that can be dynamic_cast to Widget_t.
+    /** Widgets are bucketed by their dynamic type, so this costs one
+     *  dynamic_cast per distinct type in the tree. */
+    template <typename Widget_t>
+    auto of_type() const -> Buckets_t
+    {
+        auto result = Buckets_t{};
+        for (auto const& [type, bucket] : by_type_) {
+            if (dynamic_cast<Widget_t const*>(bucket.front()) != nullptr)
+                result.push_back(&bucket);
+        }
+        return result;
+    }
+
+    /// Return the number of Widgets in the index.
+    auto size() const -> std::size_t { return slots_.size(); }
+
+   public:
+    /// Add \p child and its descendants to each indexed ancestor of \p child.
+    /** Called by Layout once \p child's parent has been set. */
+    static void child_inserted(Widget& child);
+
+    /// Remove \p child and its descendants from \p parent and its ancestors.
+    /** Called by Layout as \p child is removed from \p parent. */
+    static void child_removed(Widget& parent, Widget& child);
+
+    /// Move \p w from \p old_name to its current name in each indexed ancestor.
+    /** Called by Widget::set_name(). */
+    static void renamed(Widget& w, std::string const& old_name);
+
+   private:
+    /// Position of a Widget within its by_type_ bucket.
+    struct Slot {
+        std::type_index type;
+        std::size_t at;
+    };
+
+    std::unordered_map<std::string, Bucket_t> by_name_;
+    std::unordered_map<std::type_index, Bucket_t> by_type_;
+    std::unordered_map<Widget const*, Slot> slots_;
+
+    // The static hooks return immediately while there are no indices.
+    inline static std::size_t live_count_ = 0uL;
+
+   private:
+    /// Add \p w and each of its descendants.
+    void insert_subtree(Widget& w);
+
+    /// Remove \p w and each of its descendants.
+    void erase_subtree(Widget& w);
+
+    void insert(Widget& w);
+
+    void erase(Widget& w);
+
+    void insert_name(Widget& w, std::string const& name);
+
+    void erase_name(Widget& w, std::string const& name);
+};
+
+}  // namespace ox::detail
+#endif  // TERMOX_WIDGET_DETAIL_DESCENDANT_INDEX_HPP
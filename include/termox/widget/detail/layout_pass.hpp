@@ -0,0 +1,74 @@
+#ifndef TERMOX_WIDGET_DETAIL_LAYOUT_PASS_HPP
+#define TERMOX_WIDGET_DETAIL_LAYOUT_PASS_HPP
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ox {
+class Widget;
+}  // namespace ox
+
+namespace ox::detail {
+
+/// A single top-down pass that lays out each requesting Layout once.
+/** A pass lasts for the lifetime of the outermost Layout_pass object. Layouts
+ *  assign geometry to their children directly, and a child Layout resized or
+ *  moved during the pass is queued rather than laid out from within its
+ *  parent. Queued Layouts are laid out in the order queued once the outermost
+ *  Layout_pass ends, so nested Layouts settle in one pass without round trips
+ *  through the event queue. Main thread only. */
+class Layout_pass {
+   public:
+    using Update_t = void (*)(Widget&);
+
+   public:
+    Layout_pass() : is_outermost_{!std::exchange(is_running_, true)} {}
+
+    Layout_pass(Layout_pass const&) = delete;
+    auto operator=(Layout_pass const&) -> Layout_pass& = delete;
+
+    ~Layout_pass()
+    {
+        if (!is_outermost_)
+            return;
+        for (auto i = 0uL; i < queued_.size(); ++i) {
+            if (auto const [w, update] = queued_[i]; w != nullptr)
+                update(*w);
+        }
+        queued_.clear();
+        is_running_ = false;
+    }
+
+   public:
+    /// Call \p update with \p w at the end of the running pass.
+    /** If no pass is running, one is started and \p update is called now. \p w
+     *  must only be queued once per pass, and must be cancelled if
+     *  destroyed. */
+    static void request(Widget& w, Update_t update)
+    {
+        if (is_running_) {
+            queued_.push_back({&w, update});
+            return;
+        }
+        auto const pass = Layout_pass{};
+        update(w);
+    }
+
+    /// Forget the queued call for \p w, if any.
+    static void cancel(Widget& w)
+    {
+        for (auto& [widget, update] : queued_) {
+            if (widget == &w)
+                widget = nullptr;
+        }
+    }
+
+   private:
+    bool const is_outermost_;
+
+    inline static bool is_running_ = false;
+    inline static std::vector<std::pair<Widget*, Update_t>> queued_;
+};
+
+}  // namespace ox::detail
+#endif  // TERMOX_WIDGET_DETAIL_LAYOUT_PASS_HPP
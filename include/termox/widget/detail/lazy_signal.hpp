@@ -0,0 +1,71 @@
+#ifndef TERMOX_WIDGET_DETAIL_LAZY_SIGNAL_HPP
+#define TERMOX_WIDGET_DETAIL_LAZY_SIGNAL_HPP
+#include <memory>
+#include <utility>
+
+#include <signals_light/signal.hpp>
+
+namespace ox::detail {
+
+template <typename Signature>
+class Lazy_signal;
+
+/// sl::Signal wrapper that only allocates the Signal when first connected to.
+/** Emitting a Lazy_signal that has never been connected to is a single null
+ *  check, no Signal storage is touched. Widget has many Signals that are
+ *  emitted on every event but are rarely connected. */
+template <typename... Args>
+class Lazy_signal<void(Args...)> {
+   public:
+    using Signal_t = sl::Signal<void(Args...)>;
+
+   public:
+    /// Connect to the underlying Signal, creating it if needed.
+    template <typename... Ts>
+    auto connect(Ts&&... args) -> decltype(auto)
+    {
+        return this->get().connect(std::forward<Ts>(args)...);
+    }
+
+    /// Disconnect from the underlying Signal.
+    template <typename... Ts>
+    auto disconnect(Ts&&... args) -> decltype(auto)
+    {
+        return this->get().disconnect(std::forward<Ts>(args)...);
+    }
+
+    /// Emit the Signal, no-op if nothing has ever been connected.
+    template <typename... Ts>
+    void operator()(Ts&&... args) const
+    {
+        if (signal_ != nullptr)
+            (*signal_)(std::forward<Ts>(args)...);
+    }
+
+    /// Emit the Signal, no-op if nothing has ever been connected.
+    template <typename... Ts>
+    void emit(Ts&&... args) const
+    {
+        (*this)(std::forward<Ts>(args)...);
+    }
+
+    /// Return true if the underlying Signal has been created.
+    auto has_signal() const -> bool { return signal_ != nullptr; }
+
+    /// Return the underlying Signal, creating it if needed.
+    auto get() -> Signal_t&
+    {
+        if (signal_ == nullptr)
+            signal_ = std::make_unique<Signal_t>();
+        return *signal_;
+    }
+
+    /// Allows binding a Signal_t reference to a Lazy_signal.
+    operator Signal_t&() { return this->get(); }
+
+   private:
+    std::unique_ptr<Signal_t> signal_;
+};
+
+}  // namespace ox::detail
+#endif  // TERMOX_WIDGET_DETAIL_LAZY_SIGNAL_HPP
@@ -0,0 +1,193 @@
+#ifndef TERMOX_WIDGET_DETAIL_TREE_ITERATOR_HPP
+#define TERMOX_WIDGET_DETAIL_TREE_ITERATOR_HPP
+#include <cstddef>
+#include <iterator>
+
+#include <termox/common/small_vector.hpp>
+
+namespace ox::detail {
+
+/// A Widget on the path from the root, and the index of its next child.
+template <typename Widget_t>
+struct Tree_frame {
+    Widget_t* parent;
+    std::size_t next;
+};
+
+/// Stack of ancestors, only allocates for trees deeper than this.
+template <typename Widget_t>
+using Tree_stack_t = Small_vector<Tree_frame<Widget_t>, 16>;
+
+/// Forward iterator over the descendants of a Widget, parents first.
+/** Does not visit the root Widget. The tree must not be modified during
+ *  iteration. \p Widget_t is Widget or Widget const. */
+template <typename Widget_t>
+class Preorder_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = Widget_t;
+    using pointer           = Widget_t*;
+    using reference         = Widget_t&;
+
+   public:
+    /// Construct an end iterator.
+    Preorder_iterator() = default;
+
+    /// Construct an iterator to the first descendant of \p root.
+    explicit Preorder_iterator(Widget_t& root)
+    {
+        stack_.push_back({&root, 0uL});
+        this->next_sibling_or_end();
+    }
+
+   public:
+    auto operator*() const -> reference { return *current_; }
+
+    auto operator->() const -> pointer { return current_; }
+
+    auto operator++() -> Preorder_iterator&
+    {
+        if (!current_->children_.empty()) {
+            stack_.push_back({current_, 1uL});
+            current_ = current_->children_.front().get();
+        }
+        else
+            this->next_sibling_or_end();
+        return *this;
+    }
+
+    auto operator++(int) -> Preorder_iterator
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    auto operator==(Preorder_iterator const& other) const -> bool
+    {
+        return current_ == other.current_;
+    }
+
+    auto operator!=(Preorder_iterator const& other) const -> bool
+    {
+        return current_ != other.current_;
+    }
+
+   private:
+    Widget_t* current_ = nullptr;
+    Tree_stack_t<Widget_t> stack_;
+
+   private:
+    /// Move to the next unvisited child of the nearest ancestor that has one.
+    void next_sibling_or_end()
+    {
+        while (!stack_.empty()) {
+            auto& top = stack_.back();
+            if (top.next < top.parent->children_.size()) {
+                current_ = top.parent->children_[top.next++].get();
+                return;
+            }
+            stack_.pop_back();
+        }
+        current_ = nullptr;
+    }
+};
+
+/// Forward iterator over the descendants of a Widget, children first.
+/** Does not visit the root Widget. Each Widget is visited after all of its
+ *  descendants, so it is the safe order for teardown. The tree must not be
+ *  modified during iteration. \p Widget_t is Widget or Widget const. */
+template <typename Widget_t>
+class Postorder_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = Widget_t;
+    using pointer           = Widget_t*;
+    using reference         = Widget_t&;
+
+   public:
+    /// Construct an end iterator.
+    Postorder_iterator() = default;
+
+    /// Construct an iterator to the first descendant of \p root.
+    explicit Postorder_iterator(Widget_t& root)
+    {
+        if (root.children_.empty())
+            return;
+        stack_.push_back({&root, 1uL});
+        this->descend(root.children_.front().get());
+    }
+
+   public:
+    auto operator*() const -> reference { return *current_; }
+
+    auto operator->() const -> pointer { return current_; }
+
+    auto operator++() -> Postorder_iterator&
+    {
+        auto& top = stack_.back();
+        if (top.next < top.parent->children_.size()) {
+            this->descend(top.parent->children_[top.next++].get());
+            return *this;
+        }
+        current_ = top.parent;
+        stack_.pop_back();
+        if (stack_.empty())  // current_ is the root.
+            current_ = nullptr;
+        return *this;
+    }
+
+    auto operator++(int) -> Postorder_iterator
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    auto operator==(Postorder_iterator const& other) const -> bool
+    {
+        return current_ == other.current_;
+    }
+
+    auto operator!=(Postorder_iterator const& other) const -> bool
+    {
+        return current_ != other.current_;
+    }
+
+   private:
+    Widget_t* current_ = nullptr;
+    Tree_stack_t<Widget_t> stack_;
+
+   private:
+    /// Set current_ to the first leaf reached from \p w by first children.
+    void descend(Widget_t* w)
+    {
+        while (!w->children_.empty()) {
+            stack_.push_back({w, 1uL});
+            w = w->children_.front().get();
+        }
+        current_ = w;
+    }
+};
+
+/// Range over the descendants of a Widget, in the order of \p Iterator.
+template <typename Iterator>
+class Descendants_view {
+   public:
+    template <typename Widget_t>
+    explicit Descendants_view(Widget_t& root) : begin_{root}
+    {}
+
+   public:
+    auto begin() const -> Iterator { return begin_; }
+
+    auto end() const -> Iterator { return Iterator{}; }
+
+   private:
+    Iterator begin_;
+};
+
+}  // namespace ox::detail
+#endif  // TERMOX_WIDGET_DETAIL_TREE_ITERATOR_HPP
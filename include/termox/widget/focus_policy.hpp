@@ -1,5 +1,6 @@
 #ifndef TERMOX_WIDGET_FOCUS_POLICY_HPP
 #define TERMOX_WIDGET_FOCUS_POLICY_HPP
+#include <termox/system/detail/focus.hpp>
 
 namespace ox {
 
@@ -12,4 +13,36 @@ namespace ox {
 enum class Focus_policy { None, Tab, Click, Strong, Direct };
 
 }  // namespace ox
+
+namespace ox::detail {
+
+/// A Focus_policy that rebuilds the Tab order when it is assigned to.
+/** Type of Widget::focus_policy, read and assigned as a plain Focus_policy. */
+class Tracked_focus_policy {
+   public:
+    constexpr Tracked_focus_policy(Focus_policy p) : policy_{p} {}
+
+    Tracked_focus_policy(Tracked_focus_policy const&) = default;
+
+    auto operator=(Focus_policy p) -> Tracked_focus_policy&
+    {
+        if (p != policy_) {
+            policy_ = p;
+            Focus::invalidate_tab_chain();
+        }
+        return *this;
+    }
+
+    auto operator=(Tracked_focus_policy const& x) -> Tracked_focus_policy&
+    {
+        return *this = x.policy_;
+    }
+
+    constexpr operator Focus_policy() const { return policy_; }
+
+   private:
+    Focus_policy policy_;
+};
+
+}  // namespace ox::detail
 #endif  // TERMOX_WIDGET_FOCUS_POLICY_HPP
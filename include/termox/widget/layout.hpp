@@ -7,9 +7,14 @@
 #include <utility>
 
 #include <termox/common/transform_view.hpp>
+#include <termox/painter/detail/render_list.hpp>
+#include <termox/system/detail/focus.hpp>
 #include <termox/system/event.hpp>
 #include <termox/system/system.hpp>
+#include <termox/widget/detail/descendant_index.hpp>
+#include <termox/widget/detail/layout_pass.hpp>
 #include <termox/widget/widget.hpp>
+#include <termox/widget/widget_arena.hpp>
 
 namespace ox {
 struct Area;
@@ -43,6 +48,14 @@ class Layout : public Widget {
         (this->append_child(std::move(children)), ...);
     }
 
+    ~Layout()
+    {
+        if (is_update_deferred_)
+            System::Batch::cancel(*this);
+        if (is_update_queued_)
+            detail::Layout_pass::cancel(*this);
+    }
+
    public:
     /// Return a View of all children.
     auto get_children()
@@ -76,7 +89,10 @@ class Layout : public Widget {
             index = this->child_count();
         auto& inserted = *w;
         children_.emplace(this->iter_at(index), std::move(w));
+        detail::Render_list::invalidate();
+        detail::Focus::invalidate_tab_chain();
         inserted.set_parent(this);
+        detail::Descendant_index::child_inserted(inserted);
         inserted.enable(this->is_enabled());
         System::post_event(Child_added_event{*this, inserted});
         return inserted;
@@ -96,7 +112,8 @@ class Layout : public Widget {
     auto make_child(Args&&... args) -> Widget_t&
     {
         return this->append_child(
-            std::make_unique<Widget_t>(std::forward<Args>(args)...));
+            this->template make_unique_child<Widget_t>(
+                std::forward<Args>(args)...));
     }
 
     // TODO Remove this
@@ -105,7 +122,8 @@ class Layout : public Widget {
               typename SFINAE   = typename Widget_t::Parameters>
     auto make_child(typename Widget_t::Parameters p) -> Widget_t&
     {
-        return this->append_child(std::make_unique<Widget_t>(std::move(p)));
+        return this->append_child(
+            this->template make_unique_child<Widget_t>(std::move(p)));
     }
 
     /// Removes and returns the child pointed to by \p child.
@@ -189,6 +207,8 @@ class Layout : public Widget {
     void swap_children(std::size_t index_a, std::size_t index_b)
     {
         std::iter_swap(this->iter_at(index_a), this->iter_at(index_b));
+        detail::Render_list::invalidate();
+        detail::Focus::invalidate_tab_chain();
         System::post_event(Child_polished_event{*this, *children_[index_b]});
         System::post_event(Child_polished_event{*this, *children_[index_a]});
     }
@@ -252,35 +272,68 @@ class Layout : public Widget {
     }
 
     /// Returns true if \p descendant is a child or some other child's child etc
-    /** Not as efficient as it could be. */
     auto contains_descendant(Widget const* descendant) const -> bool
     {
-        auto const d = this->get_descendants();
-        return std::find(std::begin(d), std::end(d), descendant) != std::end(d);
+        auto const d = this->descendants_preorder();
+        return std::find_if(std::begin(d), std::end(d), [=](Widget const& w) {
+                   return &w == descendant;
+               }) != std::end(d);
     }
 
+    /// Create children made with make_child() in \p arena, nullptr to stop.
+    /** \p arena must outlive this call and any later make_child() calls, the
+     *  children themselves can outlive it. */
+    void set_child_arena(Widget_arena* arena) { child_arena_ = arena; }
+
+    /// Return the arena used by make_child(), nullptr if the heap is used.
+    auto child_arena() const -> Widget_arena* { return child_arena_; }
+
    protected:
-    /// Clients override this to post Resize and Move events to children.
+    /// Clients override this to send Resize and Move events to children.
     /** This will be called each time the children Widgets possibly need to be
      *  rearranged. Triggered by Move_event, Resize_event, Child_added_event,
-     *  Child_removed_event, Child_polished_event, and Enable_even\. */
+     *  Child_removed_event, Child_polished_event, and Enable_even\. Called
+     *  within a detail::Layout_pass, once per pass. Within a System::Batch it
+     *  is called once, after the outermost Batch ends. */
     virtual void update_geometry() = 0;
 
+    /// Call update_geometry() in the running layout pass, or in a new one.
+    /** Within a System::Batch, the call waits for the outermost Batch to end.
+     */
+    void request_update_geometry()
+    {
+        if (System::Batch::is_active()) {
+            if (!std::exchange(is_update_deferred_, true))
+                System::Batch::defer(*this, &Layout::deferred_update_geometry);
+        }
+        else if (!std::exchange(is_update_queued_, true))
+            detail::Layout_pass::request(*this, &Layout::queued_update_geometry);
+    }
+
+    /// Lay out once, after every child change posted so far has been sent.
+    /** Child_polished_events are coalesced per receiver and child until sent,
+     *  so however many children are added, removed or polished in a frame,
+     *  this posts a single layout pass. */
+    void post_update_geometry()
+    {
+        System::post_event(Child_polished_event{*this, *this});
+    }
+
     auto enable_event() -> bool override
     {
-        this->update_geometry();
+        this->request_update_geometry();
         return Widget::enable_event();
     }
 
     auto move_event(Point new_position, Point old_position) -> bool override
     {
-        this->update_geometry();
+        this->request_update_geometry();
         return Widget::move_event(new_position, old_position);
     }
 
     auto resize_event(Area new_size, Area old_size) -> bool override
     {
-        this->update_geometry();
+        this->request_update_geometry();
         return Widget::resize_event(new_size, old_size);
     }
 
@@ -289,7 +342,7 @@ class Layout : public Widget {
         // Child_added_event can be sent even if receivier is disabled, and
         // update_geometry() is capable of enabling child widgets, so don't call
         if (this->is_enabled())
-            this->update_geometry();
+            this->post_update_geometry();
         return Widget::child_added_event(child);
     }
 
@@ -298,13 +351,17 @@ class Layout : public Widget {
         // Child_removed_event can be sent even if receivier is disabled, and
         // update_geometry() is capable of enabling child widgets, so don't call
         if (this->is_enabled())
-            this->update_geometry();
+            this->post_update_geometry();
         return Widget::child_removed_event(child);
     }
 
+    /// Lay out for Child_polished_events from post_update_geometry().
     auto child_polished_event(Widget& child) -> bool override
     {
-        this->update_geometry();
+        if (&child == this)
+            this->request_update_geometry();
+        else
+            this->post_update_geometry();
         return Widget::child_polished_event(child);
     }
 
@@ -322,6 +379,35 @@ class Layout : public Widget {
     };
 
    private:
+    Widget_arena* child_arena_ = nullptr;
+    bool is_update_deferred_   = false;
+    bool is_update_queued_     = false;
+
+   private:
+    static void deferred_update_geometry(Widget& w)
+    {
+        auto& self               = static_cast<Layout&>(w);
+        self.is_update_deferred_ = false;
+        self.request_update_geometry();
+    }
+
+    static void queued_update_geometry(Widget& w)
+    {
+        auto& self             = static_cast<Layout&>(w);
+        self.is_update_queued_ = false;
+        if (self.is_enabled())
+            self.update_geometry();
+    }
+
+    /// Construct a Widget_t in the child arena, if one is set.
+    template <typename Widget_t, typename... Args>
+    auto make_unique_child(Args&&... args) -> std::unique_ptr<Widget_t>
+    {
+        if (child_arena_ != nullptr)
+            return child_arena_->make<Widget_t>(std::forward<Args>(args)...);
+        return std::make_unique<Widget_t>(std::forward<Args>(args)...);
+    }
+
     /// Get the iterator pointing to the child at \p index into children_.
     auto iter_at(std::size_t index) -> Children_t::iterator
     {
@@ -360,7 +446,10 @@ class Layout : public Widget {
     auto iter_remove(Children_t::iterator at) -> std::unique_ptr<Widget>
     {
         auto removed = std::move(*at);
+        detail::Descendant_index::child_removed(*this, *removed);
         children_.erase(at);
+        detail::Render_list::invalidate();
+        detail::Focus::invalidate_tab_chain();
         return removed;
     }
 
@@ -3,10 +3,12 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <memory_resource>
 #include <numeric>
 #include <utility>
 #include <vector>
 
+#include <termox/system/detail/frame_arena.hpp>
 #include <termox/widget/detail/border_offset.hpp>
 #include <termox/widget/size_policy.hpp>
 #include <termox/widget/widget.hpp>
@@ -25,7 +27,7 @@ struct Dimension {
 template <typename Get_policy_t>
 class Layout_span {
    private:
-    using Container_t = std::vector<Dimension>;
+    using Container_t = std::pmr::vector<Dimension>;
 
     /// \p Get_limit_t Is a functor type <std::size_t(Size_policy const&)>
     template <typename Get_limit_t>
@@ -163,9 +165,10 @@ class Layout_span {
                              [](auto const& d) { return d.widget != nullptr; });
     }
 
-    auto get_results() const -> std::vector<std::size_t>
+    auto get_results() const -> std::pmr::vector<std::size_t>
     {
-        auto result = std::vector<std::size_t>{};
+        auto result =
+            std::pmr::vector<std::size_t>{ox::detail::Frame_arena::resource()};
         result.reserve(dimensions_.size());
         std::transform(dimensions_.begin(), dimensions_.end(),
                        std::back_inserter(result),
@@ -185,7 +188,7 @@ class Layout_span {
     static auto generate_zero_init_dimensions(Iter first, Iter last)
         -> Container_t
     {
-        auto result = Container_t{};
+        auto result = Container_t{ox::detail::Frame_arena::resource()};
         result.reserve(std::distance(first, last));
         std::transform(first, last, std::back_inserter(result),
                        [](auto& child) -> Dimension {
@@ -154,6 +154,8 @@ class Linear_layout : public Layout<Child> {
    protected:
     void update_geometry() override
     {
+        auto const pass = ox::detail::Layout_pass{};
+
         auto const primary_lengths = shared_space_.calculate_lengths(*this);
         auto const primary_pos =
             shared_space_.calculate_positions(primary_lengths);
@@ -162,6 +164,7 @@ class Linear_layout : public Layout<Child> {
         auto const secondary_pos =
             unique_space_.calculate_positions(secondary_lengths);
 
+        // Geometry is assigned directly, child Layouts lay out after this one.
         this->send_enable_disable_events(primary_lengths, secondary_lengths);
         this->send_resize_events(primary_lengths, secondary_lengths);
         this->send_move_events(primary_pos, secondary_pos);
@@ -185,13 +188,16 @@ class Linear_layout : public Layout<Child> {
             if (parent != nullptr)
                 System::post_event(Child_polished_event{*parent, *this});
         }
-        this->update_geometry();
+        if (&child == this)
+            this->request_update_geometry();
+        else
+            this->post_update_geometry();
         return Widget::child_polished_event(child);
     }
 
    private:
-    using Length_list   = std::vector<std::size_t>;
-    using Position_list = std::vector<std::size_t>;
+    using Length_list   = std::pmr::vector<std::size_t>;
+    using Position_list = std::pmr::vector<std::size_t>;
 
     Shared_space<Parameters> shared_space_;
     Unique_space<Parameters> unique_space_;
@@ -232,7 +238,7 @@ class Linear_layout : public Layout<Child> {
             if (child.is_enabled()) {
                 auto const area =
                     typename Parameters::get_area{}(primary[i], secondary[i]);
-                System::post_event(Resize_event{child, area});
+                System::send_event(Resize_event{child, area});
             }
         }
     }
@@ -252,7 +258,7 @@ class Linear_layout : public Layout<Child> {
                 auto const point = typename Parameters::get_point{}(
                     primary[i] + primary_offset,
                     secondary[i] + secondary_offset);
-                System::post_event(Move_event{child, point});
+                System::send_event(Move_event{child, point});
             }
         }
     }
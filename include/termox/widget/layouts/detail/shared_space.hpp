@@ -1,8 +1,10 @@
 #ifndef TERMOX_WIDGET_LAYOUTS_DETAIL_SHARED_SPACE_HPP
 #define TERMOX_WIDGET_LAYOUTS_DETAIL_SHARED_SPACE_HPP
 #include <cstddef>
+#include <memory_resource>
 #include <vector>
 
+#include <termox/system/detail/frame_arena.hpp>
 #include <termox/widget/size_policy.hpp>
 #include <termox/widget/widget.hpp>
 
@@ -14,8 +16,8 @@ namespace ox::layout::detail {
 template <typename Parameters>
 class Shared_space {
    private:
-    using Length_list   = std::vector<std::size_t>;
-    using Position_list = std::vector<std::size_t>;
+    using Length_list   = std::pmr::vector<std::size_t>;
+    using Position_list = std::pmr::vector<std::size_t>;
 
    public:
     auto calculate_lengths(Widget& parent) -> Length_list
@@ -46,7 +48,7 @@ class Shared_space {
     /// Returns local primary dimension positions, starting at zero.
     auto calculate_positions(Length_list const& lengths) -> Position_list
     {
-        auto result = Position_list{};
+        auto result = Position_list{ox::detail::Frame_arena::resource()};
         result.reserve(lengths.size());
         auto running_total = 0uL;
         for (auto length : lengths) {
@@ -1,9 +1,11 @@
 #ifndef TERMOX_WIDGET_LAYOUTS_DETAIL_UNIQUE_SPACE_HPP
 #define TERMOX_WIDGET_LAYOUTS_DETAIL_UNIQUE_SPACE_HPP
 #include <cstddef>
+#include <memory_resource>
 #include <utility>
 #include <vector>
 
+#include <termox/system/detail/frame_arena.hpp>
 #include <termox/widget/widget.hpp>
 
 namespace ox::layout::detail {
@@ -12,13 +14,13 @@ namespace ox::layout::detail {
 template <typename Parameters>
 class Unique_space {
    private:
-    using Length_list   = std::vector<std::size_t>;
-    using Position_list = std::vector<std::size_t>;
+    using Length_list   = std::pmr::vector<std::size_t>;
+    using Position_list = std::pmr::vector<std::size_t>;
 
    public:
     auto calculate_lengths(Widget& parent) -> Length_list
     {
-        auto result      = Length_list{};
+        auto result      = Length_list{ox::detail::Frame_arena::resource()};
         auto const limit = typename Parameters::Secondary::get_length{}(parent);
         auto children    = parent.get_children();
         auto begin       = std::next(std::begin(children), offset_);
@@ -39,7 +41,8 @@ class Unique_space {
 
     auto calculate_positions(Length_list const& lengths) -> Position_list
     {
-        return Position_list(lengths.size(), 0uL);
+        return Position_list(lengths.size(), 0uL,
+                             ox::detail::Frame_arena::resource());
     }
 
     /// Return the child Widget offset, the first widget included in the layout.
@@ -211,13 +211,13 @@ class Stack : public Layout<Child_t> {
     void move_active_page()
     {
         if (active_page_ != nullptr)
-            System::post_event(Move_event{*active_page_, this->top_left()});
+            System::send_event(Move_event{*active_page_, this->top_left()});
     }
 
     void resize_active_page()
     {
         if (active_page_ != nullptr)
-            System::post_event(Resize_event{*active_page_, this->outer_area()});
+            System::send_event(Resize_event{*active_page_, this->outer_area()});
     }
 };
 
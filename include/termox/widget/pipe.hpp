@@ -1,6 +1,7 @@
 #ifndef TERMOX_WIDGET_PIPE_HPP
 #define TERMOX_WIDGET_PIPE_HPP
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -13,6 +14,8 @@
 #include <termox/painter/glyph_string.hpp>
 #include <termox/system/animation_engine.hpp>
 #include <termox/widget/align.hpp>
+#include <termox/widget/detail/descendant_index.hpp>
+#include <termox/widget/detail/tree_iterator.hpp>
 #include <termox/widget/focus_policy.hpp>
 #include <termox/widget/growth.hpp>
 #include <termox/widget/point.hpp>
@@ -35,6 +38,156 @@ template <typename W>
 class Dynamic_filter_predicate {
    public:
     using Widget_t = W;
+
+   public:
+    auto operator()(Widget const& w) const -> bool
+    {
+        return dynamic_cast<Widget_t const*>(&w) != nullptr;
+    }
+};
+
+/// Used to call operator| overload to create a new Range of Widgets by name.
+class Name_predicate {
+   public:
+    Name_predicate() = default;
+
+    explicit Name_predicate(std::string n) : name{std::move(n)} {}
+
+   public:
+    std::string name;
+
+   public:
+    auto operator()(Widget const& w) const -> bool { return w.name() == name; }
+};
+
+/// Pre-order Range over the descendants of root, see pipe::descendants().
+/** Keeps the root so that find() and filter<>() can use its index. */
+template <typename Widget_t>
+class Descendants_range
+    : public Range<ox::detail::Preorder_iterator<Widget_t>,
+                   ox::detail::Preorder_iterator<Widget_t>> {
+   public:
+    using Iterator_t = ox::detail::Preorder_iterator<Widget_t>;
+
+   public:
+    explicit Descendants_range(Widget_t& root)
+        : Range<Iterator_t, Iterator_t>{Iterator_t{root}, Iterator_t{}},
+          root_{root}
+    {}
+
+   public:
+    auto root() const -> Widget_t& { return root_; }
+
+    /// Copy into a vector, as descendants() returned before it was a Range.
+    /** Allocates, kept so `std::vector<Widget*> v = w | descendants();`
+     *  still compiles. */
+    operator std::vector<Widget*>() const { return root_.get_descendants(); }
+
+   private:
+    Widget_t& root_;
+};
+
+/// Forward iterator over the descendants of a Widget that satisfy Predicate.
+/** Walks buckets from the root's Descendant_index if it has one, otherwise
+ *  scans every descendant in pre-order. \p Widget_t is Widget or Widget
+ *  const. */
+template <typename Widget_t, typename Predicate>
+class Query_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = Widget_t;
+    using pointer           = Widget_t*;
+    using reference         = Widget_t&;
+
+    using Buckets_t = ox::detail::Descendant_index::Buckets_t;
+
+   public:
+    /// Construct an end iterator.
+    Query_iterator() = default;
+
+    /// Visit each Widget in \p buckets.
+    explicit Query_iterator(Buckets_t buckets)
+        : buckets_{std::move(buckets)}, is_indexed_{true}
+    {
+        this->skip_finished_buckets();
+    }
+
+    /// Visit each descendant of \p root that satisfies \p predicate.
+    Query_iterator(Widget_t& root, Predicate predicate)
+        : scan_{root}, predicate_{std::move(predicate)}
+    {
+        this->skip_unmatched();
+    }
+
+   public:
+    auto operator*() const -> reference { return *this->current(); }
+
+    auto operator->() const -> pointer { return this->current(); }
+
+    auto operator++() -> Query_iterator&
+    {
+        if (is_indexed_) {
+            ++at_;
+            this->skip_finished_buckets();
+        }
+        else {
+            ++scan_;
+            this->skip_unmatched();
+        }
+        return *this;
+    }
+
+    auto operator++(int) -> Query_iterator
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    auto operator==(Query_iterator const& other) const -> bool
+    {
+        return this->current() == other.current();
+    }
+
+    auto operator!=(Query_iterator const& other) const -> bool
+    {
+        return this->current() != other.current();
+    }
+
+   private:
+    using Scan_t = ox::detail::Preorder_iterator<Widget_t>;
+
+    Buckets_t buckets_;
+    std::size_t bucket_ = 0uL;
+    std::size_t at_     = 0uL;
+    Scan_t scan_;
+    Predicate predicate_;
+    bool is_indexed_ = false;
+
+   private:
+    /// Return the current Widget, or nullptr at the end.
+    auto current() const -> pointer
+    {
+        if (is_indexed_)
+            return bucket_ < buckets_.size() ? (*buckets_[bucket_])[at_]
+                                             : nullptr;
+        return scan_ != Scan_t{} ? &*scan_ : nullptr;
+    }
+
+    void skip_finished_buckets()
+    {
+        while (bucket_ < buckets_.size() && at_ == buckets_[bucket_]->size()) {
+            ++bucket_;
+            at_ = 0uL;
+        }
+    }
+
+    void skip_unmatched()
+    {
+        while (scan_ != Scan_t{} && !predicate_(*scan_))
+            ++scan_;
+    }
 };
 
 template <typename T>
@@ -70,10 +223,17 @@ inline auto children()
     };
 }
 
-/// Widget -> std::vector<Widget*>
+/// Widget -> Range<Descendants>, in pre-order, without allocating.
 inline auto descendants()
 {
-    return [](auto&& w) { return get(w).get_descendants(); };
+    return [](auto&& w) {
+        auto& root = get(w);
+        using Root_t =
+            std::conditional_t<std::is_const_v<std::remove_reference_t<
+                                   decltype(root)>>,
+                               Widget const, Widget>;
+        return detail::Descendants_range<Root_t>{root};
+    };
 }
 
 // Generic Tools ---------------------------------------------------------------
@@ -94,13 +254,15 @@ auto filter(F&& predicate)
 }
 
 /// Filter by name of Widget
+/** A hash lookup after descendants() if the root has a descendant index. */
 inline auto find(std::string const& name)
 {
-    return detail::Filter_predicate{
-        [=](auto const& w) { return w.name() == name; }};
+    return detail::Name_predicate{name};
 }
 
 /// Dynamic cast, be aware.
+/** After descendants(), if the root has a descendant index, this is one
+ *  dynamic_cast per distinct type instead of one per descendant. */
 template <typename Widget_t>
 auto filter()
 {
@@ -1862,6 +2024,51 @@ auto operator|(Range<Iter_1, Iter_2> children,
                  children.end()};
 }
 
+/// Overload to filter by name.
+template <typename Iter_1, typename Iter_2>
+auto operator|(Range<Iter_1, Iter_2> children, pipe::detail::Name_predicate p)
+{
+    return Range{
+        Filter_iterator{children.begin(), children.end(), std::move(p)},
+        children.end()};
+}
+
+/// Overload to find by name, from the root's descendant index if it has one.
+template <typename Widget_t>
+auto operator|(pipe::detail::Descendants_range<Widget_t> descendants,
+               pipe::detail::Name_predicate p)
+{
+    using Iter =
+        pipe::detail::Query_iterator<Widget_t, pipe::detail::Name_predicate>;
+    auto const* const index = descendants.root().descendant_index();
+    if (index == nullptr || p.name.empty())
+        return Range{Iter{descendants.root(), std::move(p)}, Iter{}};
+    auto buckets = typename Iter::Buckets_t{};
+    if (auto const* const named = index->named(p.name); named != nullptr)
+        buckets.push_back(named);
+    return Range{Iter{std::move(buckets)}, Iter{}};
+}
+
+/// Overload to filter by type, from the root's descendant index if it has one.
+template <typename Widget_t, typename Derived_t>
+auto operator|(pipe::detail::Descendants_range<Widget_t> descendants,
+               pipe::detail::Dynamic_filter_predicate<Derived_t> p)
+{
+    using Iter = pipe::detail::Query_iterator<
+        Widget_t, pipe::detail::Dynamic_filter_predicate<Derived_t>>;
+    using Derived_ref = std::conditional_t<std::is_const_v<Widget_t>,
+                                           Derived_t const&, Derived_t&>;
+    auto const* const index = descendants.root().descendant_index();
+    auto const begin =
+        index == nullptr ? Iter{descendants.root(), p}
+                         : Iter{index->template of_type<Derived_t>()};
+    auto constexpr downcast = [](Widget_t& w) -> Derived_ref {
+        return static_cast<Derived_ref>(w);
+    };
+    return Range{Transform_iterator{begin, downcast},
+                 Transform_iterator{Iter{}, downcast}};
+}
+
 // clang-format off
 // clang format can't handle this one at the moment.
 
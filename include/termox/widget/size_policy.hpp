@@ -4,22 +4,30 @@
 #include <limits>
 #include <utility>
 
-#include <signals_light/signal.hpp>
+#include <termox/widget/detail/lazy_signal.hpp>
 
 namespace ox {
+class Widget;
+namespace detail {
+
+/// Notify \p owner's parent that one of its Size_policies changed.
+/** Defined in widget.cpp, so Size_policy does not depend on Widget. */
+void size_policy_updated(Widget& owner);
+
+}  // namespace detail
 
 /// Defines how a Layout should resize a Widget in one length Dimension.
 class Size_policy {
    public:
     /// Emitted on any changes to the Size_policy.
-    sl::Signal<void()> policy_updated;
+    detail::Lazy_signal<void()> policy_updated;
 
    public:
     /// Set the size hint, used as the initial value in calculations.
     void hint(std::size_t value)
     {
         data_.hint = value;
-        this->policy_updated();
+        this->notify();
     }
 
     /// Return the size hint currently being used.
@@ -31,7 +39,7 @@ class Size_policy {
         data_.min = value;
         if (data_.max < data_.min)
             data_.max = data_.min;
-        this->policy_updated();
+        this->notify();
     }
 
     /// Return the minimum length currently set.
@@ -43,7 +51,7 @@ class Size_policy {
         data_.max = value;
         if (data_.min > data_.max)
             data_.min = data_.max;
-        this->policy_updated();
+        this->notify();
     }
 
     /// Return the maximum length currently set.
@@ -56,7 +64,7 @@ class Size_policy {
         if (value <= 0.)
             return;
         data_.stretch = value;
-        this->policy_updated();
+        this->notify();
     }
 
     /// Return the stretch value currently being used.
@@ -73,7 +81,7 @@ class Size_policy {
     void passive(bool x)
     {
         data_.passive = x;
-        this->policy_updated();
+        this->notify();
     }
 
     /// Return true if Size_policy is passive.
@@ -88,7 +96,7 @@ class Size_policy {
         data_.max     = hint;
         data_.stretch = 1.;
         data_.passive = false;
-        this->policy_updated();
+        this->notify();
     }
 
     /// Minimum: \p hint is the minimum acceptable size, may be larger.
@@ -116,7 +124,7 @@ class Size_policy {
         if (hint > data_.max)
             data_.max = hint;
         data_.passive = false;
-        this->policy_updated();
+        this->notify();
     }
 
     /// Expanding: \p hint is preferred, but it will expand to use extra space.
@@ -129,7 +137,7 @@ class Size_policy {
         if (hint > data_.max)
             data_.max = hint;
         data_.passive = false;
-        this->policy_updated();
+        this->notify();
     }
 
     /// Minimum Expanding: \p hint is minimum, it will expand into unused space.
@@ -148,32 +156,39 @@ class Size_policy {
         data_.min     = 0;
         data_.max     = max_max_;
         data_.passive = false;
-        this->policy_updated();
+        this->notify();
     }
 
    public:
     Size_policy() = default;
 
+    /// Construct a Size_policy that notifies \p owner's parent on changes.
+    /** The owning Widget is notified directly instead of through a connected
+     *  Slot, so policy_updated is only allocated if someone else connects. */
+    explicit Size_policy(Widget& owner) : owner_{&owner} {}
+
     Size_policy(Size_policy const& x) = delete;
     Size_policy(Size_policy&& x)      = delete;
 
-    /// Specifically does not copy the Signal, so Widget is still notified.
+    /// Does not copy the Signal or owner, so the owner is still notified.
     auto operator=(Size_policy const& x) -> Size_policy&
     {
         this->data_ = x.data_;
-        this->policy_updated();
+        this->notify();
         return *this;
     }
 
-    /// Specifically does not copy the Signal, so Widget is still notified.
+    /// Does not copy the Signal or owner, so the owner is still notified.
     auto operator=(Size_policy&& x) -> Size_policy&
     {
         this->data_ = std::move(x.data_);
-        this->policy_updated();
+        this->notify();
         return *this;
     }
 
    private:
+    Widget* owner_ = nullptr;
+
     struct Data {
         std::size_t hint    = 0;
         std::size_t min     = 0;
@@ -185,6 +200,14 @@ class Size_policy {
 
     static auto constexpr max_max_ =
         std::numeric_limits<decltype(data_.max)>::max();
+
+   private:
+    void notify()
+    {
+        if (owner_ != nullptr)
+            detail::size_policy_updated(*owner_);
+        this->policy_updated();
+    }
 };
 
 /// Implementation Helper
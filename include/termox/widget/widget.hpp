@@ -1,11 +1,12 @@
 #ifndef TERMOX_WIDGET_WIDGET_HPP
 #define TERMOX_WIDGET_WIDGET_HPP
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <optional>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -27,9 +28,16 @@
 #include <termox/widget/border.hpp>
 #include <termox/widget/cursor.hpp>
 #include <termox/widget/detail/border_offset.hpp>
+#include <termox/widget/detail/lazy_signal.hpp>
+#include <termox/widget/detail/tree_iterator.hpp>
 #include <termox/widget/focus_policy.hpp>
 #include <termox/widget/point.hpp>
 #include <termox/widget/size_policy.hpp>
+#include <termox/widget/widget_arena.hpp>
+
+namespace ox::detail {
+class Descendant_index;
+}  // namespace ox::detail
 
 namespace ox {
 
@@ -41,14 +49,23 @@ class Widget {
         std::optional<Glyph> wallpaper;
     };
 
+    using Event_filters_t = std::vector<Widget*>;
+
    private:
     template <typename Signature>
-    using Signal = sl::Signal<Signature>;
+    using Signal = detail::Lazy_signal<Signature>;
+
+    template <typename>
+    friend class detail::Preorder_iterator;
+
+    template <typename>
+    friend class detail::Postorder_iterator;
 
    public:
     // Event Signals - Alternatives to overriding virtual event handlers.
     /* Called after event handlers are invoked. Parameters are in same order as
-     * matching event handler function's parameters. */
+     * matching event handler function's parameters. Signal storage is only
+     * allocated once a Slot is connected, emitting before that is free. */
     Signal<void()> enabled;
     Signal<void()> disabled;
     Signal<void(Widget&)> child_added;
@@ -93,16 +110,16 @@ class Widget {
     Border border;
 
     /// Describes how focus is given to this Widget.
-    Focus_policy focus_policy{Focus_policy::None};
+    detail::Tracked_focus_policy focus_policy{Focus_policy::None};
 
     /// Provides information on where the cursor is and if it is enabled.
     Cursor cursor;
 
     /// Describes how the width of this Widget should be modified by a Layout.
-    Size_policy width_policy;
+    Size_policy width_policy{*this};
 
     /// Describes how the height of this Widget should be modified by a Layout.
-    Size_policy height_policy;
+    Size_policy height_policy{*this};
 
     /// A Brush that is applied to every Glyph painted by this Widget.
     Brush brush{bg(Color::Background), fg(Color::Foreground)};
@@ -121,15 +138,51 @@ class Widget {
     Widget& operator=(Widget const&) = delete;
     Widget& operator=(Widget&&) = delete;
 
-    virtual ~Widget()
+    virtual ~Widget();
+
+    /// Allocates from the current Widget_arena, or the heap if there is none.
+    static auto operator new(std::size_t size) -> void*
+    {
+        return detail::allocate_widget(size);
+    }
+
+    /// Returns memory to the Widget_arena or heap it was allocated from.
+    static void operator delete(void* p, std::size_t size) noexcept
+    {
+        detail::deallocate_widget(p, size);
+    }
+
+    /// As operator new(std::size_t), but returns nullptr on failure.
+    static auto operator new(std::size_t size, std::nothrow_t const&) noexcept
+        -> void*
+    {
+        try {
+            return detail::allocate_widget(size);
+        }
+        catch (...) {
+            return nullptr;
+        }
+    }
+
+    /// Called if a constructor throws after the nothrow operator new.
+    static void operator delete(void* p, std::nothrow_t const&) noexcept
     {
-        if (detail::Focus::focus_widget() == this)
-            detail::Focus::clear();
+        detail::deallocate_widget(p);
     }
 
+    /// Constructs in storage provided by the caller, as the global form does.
+    static auto operator new(std::size_t, void* p) noexcept -> void*
+    {
+        return p;
+    }
+
+    /// Called if a constructor throws after the placement operator new.
+    static void operator delete(void*, void*) noexcept {}
+
    public:
     /// Set the identifying name of the Widget.
-    void set_name(std::string name) { name_ = std::move(name); }
+    /** Updates the descendant index of any indexed ancestor. */
+    void set_name(std::string name);
 
     /// Return the name of the Widget.
     auto name() const -> std::string const& { return name_; }
@@ -239,6 +292,7 @@ class Widget {
 
     // TODO remove virtual
     /// Post a paint event to this Widget.
+    /** No-op if this Widget already has a paint event pending. */
     virtual void update();
 
     /// Install another Widget as an Event filter.
@@ -251,20 +305,26 @@ class Widget {
 
     /// Remove a Widget from the Event filter list.
     /** No-op if \p filter is not already installed. */
-    void remove_event_filter(Widget& filter) { event_filters_.erase(&filter); }
+    void remove_event_filter(Widget& filter);
+
+    /// Return the list of Event filter Widgets, in installation order.
+    auto get_event_filters() const -> Event_filters_t const&
+    {
+        return event_filters_ ? *event_filters_ : no_event_filters_;
+    }
 
-    /// Return the list of Event filter Widgets.
-    auto get_event_filters() const -> std::set<Widget*> const&
+    /// Return the number of Event filters installed across all Widgets.
+    /** When zero, the filter stage of event dispatch is skipped entirely. */
+    static auto installed_filter_count() -> std::size_t
     {
-        return event_filters_;
+        return installed_filter_count_;
     }
 
     /// Enable animation on this Widget.
     /** Animated widgets receiver a Timer_event every \p period. This Timer
-     *  Event should be used to update the state of the Widget. This is all
-     *  handled on a separate thread from the main user input thread, and has
-     *  its own staged_changes object that it paints to to avoid shared data
-     *  issues. */
+     *  Event should be used to update the state of the Widget. The timer runs
+     *  on the Timer_scheduler thread, but each Timer_event is sent on the main
+     *  thread. */
     void enable_animation(Animation_engine::Period_t period)
     {
         if (is_animated_)
@@ -314,17 +374,85 @@ class Widget {
         return Transform_view(children_, dereference);
     }
 
-    /// Return container of all descendants of self_.
+    /// Return container of all descendants of self_, in pre-order.
+    /** Prefer for_each_descendant() or descendants_preorder(), which do not
+     *  allocate. */
     auto get_descendants() const -> std::vector<Widget*>
     {
-        auto descendants = std::vector<Widget*>{};
-        for (auto const& w_ptr : children_) {
-            descendants.push_back(w_ptr.get());
-            auto branch = w_ptr->get_descendants();
-            descendants.insert(std::end(descendants), std::begin(branch),
-                               std::end(branch));
-        }
-        return descendants;
+        auto result = std::vector<Widget*>{};
+        // Children are owned as non-const, as from children_.get().
+        this->for_each_descendant([&result](Widget const& w) {
+            result.push_back(const_cast<Widget*>(&w));
+        });
+        return result;
+    }
+
+    /// Return a range of Widget& to each descendant, parents before children.
+    /** Walks the tree with a small inline stack, without allocating. The tree
+     *  must not be modified while iterating. */
+    auto descendants_preorder() -> detail::Descendants_view<
+        detail::Preorder_iterator<Widget>>
+    {
+        return detail::Descendants_view<detail::Preorder_iterator<Widget>>{
+            *this};
+    }
+
+    /// Return a range of Widget const& to each descendant, in pre-order.
+    auto descendants_preorder() const -> detail::Descendants_view<
+        detail::Preorder_iterator<Widget const>>
+    {
+        return detail::Descendants_view<
+            detail::Preorder_iterator<Widget const>>{*this};
+    }
+
+    /// Return a range of Widget& to each descendant, children before parents.
+    /** Like descendants_preorder(), but each Widget comes after all of its
+     *  own descendants. */
+    auto descendants_postorder() -> detail::Descendants_view<
+        detail::Postorder_iterator<Widget>>
+    {
+        return detail::Descendants_view<detail::Postorder_iterator<Widget>>{
+            *this};
+    }
+
+    /// Return a range of Widget const& to each descendant, in post-order.
+    auto descendants_postorder() const -> detail::Descendants_view<
+        detail::Postorder_iterator<Widget const>>
+    {
+        return detail::Descendants_view<
+            detail::Postorder_iterator<Widget const>>{*this};
+    }
+
+    /// Call \p visit with a Widget& to each descendant, in pre-order.
+    template <typename F>
+    void for_each_descendant(F&& visit)
+    {
+        for (Widget& w : this->descendants_preorder())
+            visit(w);
+    }
+
+    /// Call \p visit with a Widget const& to each descendant, in pre-order.
+    template <typename F>
+    void for_each_descendant(F&& visit) const
+    {
+        for (Widget const& w : this->descendants_preorder())
+            visit(w);
+    }
+
+    /// Index descendants by name and type for pipe::find and pipe::filter.
+    /** With an index, `*this | descendants() | find(name)` is a hash lookup
+     *  instead of a scan of every descendant. The index is kept up to date as
+     *  children are inserted, removed and renamed, at some memory cost per
+     *  descendant. Indexed results are not in pre-order. */
+    void enable_descendant_index();
+
+    /// Remove the descendant index, queries go back to scanning.
+    void disable_descendant_index();
+
+    /// Return the descendant index, or nullptr if it is not enabled.
+    auto descendant_index() const -> detail::Descendant_index const*
+    {
+        return descendant_index_.get();
     }
 
     /// If true, the brush will apply to the wallpaper Glyph.
@@ -647,6 +775,7 @@ class Widget {
     bool enabled_                = false;
     bool brush_paints_wallpaper_ = true;
     bool is_animated_            = false;
+    std::atomic<bool> needs_paint_{false};
 
    protected:
     using Children_t = std::vector<std::unique_ptr<Widget>>;
@@ -657,8 +786,16 @@ class Widget {
     std::string name_;
     Widget* parent_ = nullptr;
     std::optional<Glyph> wallpaper_;
+    std::uint16_t const unique_id_;
     detail::Screen_descriptor screen_state_;
-    std::set<Widget*> event_filters_;
+
+    // Allocated on first install_event_filter(), most Widgets have none.
+    std::unique_ptr<Event_filters_t> event_filters_;
+    inline static Event_filters_t const no_event_filters_{};
+    inline static std::size_t installed_filter_count_ = 0uL;
+
+    // Allocated by enable_descendant_index(), most Widgets have none.
+    std::unique_ptr<detail::Descendant_index> descendant_index_;
 
     // Top left point of *this, relative to the top left of the screen.
     // This Point is the same with or without a border enabled.
@@ -667,8 +804,6 @@ class Widget {
     // The entire area of the widget, including any border space.
     Area outer_area_{width_policy.hint(), height_policy.hint()};
 
-    std::uint16_t const unique_id_;
-
    public:
     /// Should only be used by Move_event send() function.
     void set_top_left(Point p) { top_left_position_ = p; }
@@ -677,6 +812,15 @@ class Widget {
     void set_outer_area(Area a) { outer_area_ = a; }
 
     void set_parent(Widget* parent) { parent_ = parent; }
+
+    /// Should only be used by detail::Paint_queue, true if a paint is pending.
+    auto needs_paint() -> std::atomic<bool>& { return needs_paint_; }
+
+    /// Should only be used by detail::Descendant_index to keep it up to date.
+    auto descendant_index() -> detail::Descendant_index*
+    {
+        return descendant_index_.get();
+    }
 };
 
 /// Helper function to create an instance.
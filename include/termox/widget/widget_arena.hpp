@@ -0,0 +1,85 @@
+#ifndef TERMOX_WIDGET_WIDGET_ARENA_HPP
+#define TERMOX_WIDGET_WIDGET_ARENA_HPP
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace ox {
+namespace detail {
+class Widget_arena_state;
+}  // namespace detail
+
+/// Block allocator for Widgets that are created and destroyed together.
+/** Memory is taken from large blocks, and a destroyed Widget's memory is kept
+ *  on a free list for its size, to be reused by the next Widget of that size.
+ *  Opening and closing the same dialog repeatedly reuses the same memory
+ *  instead of fragmenting the heap. Widgets are allocated from an arena while
+ *  one of its Scopes is active on the creating thread, or by Layouts that
+ *  have been given the arena with Layout::set_child_arena(). The blocks are
+ *  released once the arena is destroyed and every Widget from it is gone, so
+ *  Widgets can outlive the arena. Thread safe. */
+class Widget_arena {
+   public:
+    /// Allocate blocks of \p block_size bytes, larger Widgets get their own.
+    explicit Widget_arena(std::size_t block_size = 64 * 1'024);
+
+    Widget_arena(Widget_arena const&) = delete;
+    Widget_arena(Widget_arena&&)      = delete;
+    auto operator=(Widget_arena const&) -> Widget_arena& = delete;
+    auto operator=(Widget_arena&&) -> Widget_arena& = delete;
+
+    ~Widget_arena();
+
+   public:
+    /// Widgets created on this thread during its lifetime use the arena.
+    /** Scopes nest, the innermost Scope's arena is used. */
+    class Scope {
+       public:
+        explicit Scope(Widget_arena& arena);
+
+        Scope(Scope const&) = delete;
+        auto operator=(Scope const&) -> Scope& = delete;
+
+        ~Scope();
+
+       private:
+        detail::Widget_arena_state* previous_;
+    };
+
+   public:
+    /// Create a Widget_t, and any Widgets its constructor creates, in *this.
+    template <typename Widget_t, typename... Args>
+    auto make(Args&&... args) -> std::unique_ptr<Widget_t>
+    {
+        auto const scope = Scope{*this};
+        return std::make_unique<Widget_t>(std::forward<Args>(args)...);
+    }
+
+    /// Return the number of Widgets currently allocated from *this.
+    auto live_count() const -> std::size_t;
+
+    /// Return the number of bytes of block memory currently held.
+    auto reserved_bytes() const -> std::size_t;
+
+   private:
+    detail::Widget_arena_state* state_;
+};
+
+namespace detail {
+
+/// Allocate \p size bytes for a Widget, from the current arena if any.
+/** Used by Widget::operator new. */
+auto allocate_widget(std::size_t size) -> void*;
+
+/// Release memory from allocate_widget(), to whichever arena it came from.
+/** Used by Widget::operator delete. */
+void deallocate_widget(void* p, std::size_t size) noexcept;
+
+/// Release memory from allocate_widget() when its size is not known.
+/** Arena memory released this way is not reused until the arena's blocks are
+ *  released. Used by the nothrow Widget::operator delete. */
+void deallocate_widget(void* p) noexcept;
+
+}  // namespace detail
+}  // namespace ox
+#endif  // TERMOX_WIDGET_WIDGET_ARENA_HPP
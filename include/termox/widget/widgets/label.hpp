@@ -74,17 +74,11 @@ class Label : public Widget {
 
    public:
     /// Set text contents of Label and update display.
-    void set_text(Glyph_string text)
-    {
-        if (growth_strategy_ == Growth::Dynamic) {
-            if constexpr (is_vertical)
-                *this | pipe::fixed_height(text.size());
-            else
-                *this | pipe::fixed_width(text.size());
-        }
-        text_ = std::move(text);
-        this->update_offset();
-    }
+    /** Copying reuses the existing text storage when it is large enough. */
+    void set_text(Glyph_string const& text) { this->assign_text(text); }
+
+    /// Set text contents of Label and update display.
+    void set_text(Glyph_string&& text) { this->assign_text(std::move(text)); }
 
     /// Return the text given to set_text().
     auto get_text() const -> Glyph_string const& { return text_; }
@@ -163,6 +157,20 @@ class Label : public Widget {
     std::size_t offset_ = 0uL;
 
    private:
+    /// Copy or move \p text into text_, resizing if the growth is dynamic.
+    template <typename Text>
+    void assign_text(Text&& text)
+    {
+        if (growth_strategy_ == Growth::Dynamic) {
+            if constexpr (is_vertical)
+                *this | pipe::fixed_height(text.size());
+            else
+                *this | pipe::fixed_width(text.size());
+        }
+        text_ = std::forward<Text>(text);
+        this->update_offset();
+    }
+
     /// Update the internal offset_ value to account for new settings/state
     void update_offset()
     {
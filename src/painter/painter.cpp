@@ -31,7 +31,9 @@ Painter::Painter(Widget& widg)
     : widget_{widg},
       inner_area_{widget_.width(), widget_.height()},
       is_paintable_{detail::is_paintable(widget_)},
-      staged_changes_{detail::Staged_changes::get()[&widg]}
+      staging_lock_{detail::Staged_changes::local().mtx},
+      staged_changes_{detail::Staged_changes::local()
+                          .changes[detail::Staged_changes::key(widg)]}
 {}
 
 void Painter::put(Glyph tile, std::size_t x, std::size_t y)
@@ -0,0 +1,139 @@
+#include <termox/painter/detail/render_list.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+
+#include <termox/painter/detail/is_paintable.hpp>
+#include <termox/painter/detail/screen_mask.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+#include <termox/widget/widget.hpp>
+
+namespace ox::detail {
+
+Render_list::Render_list(std::pmr::memory_resource* mr)
+    : widgets_{mr},
+      parents_{mr},
+      depths_{mr},
+      subtree_ends_{mr},
+      outers_{mr},
+      inners_{mr},
+      flags_{mr},
+      by_address_{mr}
+{}
+
+void Render_list::build(Widget& root)
+{
+    this->clear();
+    this->append(root, npos, 0);
+    std::sort(std::begin(by_address_), std::end(by_address_));
+}
+
+void Render_list::clear()
+{
+    widgets_.clear();
+    parents_.clear();
+    depths_.clear();
+    subtree_ends_.clear();
+    outers_.clear();
+    inners_.clear();
+    flags_.clear();
+    by_address_.clear();
+}
+
+auto Render_list::find(Widget const& w) const -> Index
+{
+    auto const at = std::lower_bound(
+        std::begin(by_address_), std::end(by_address_), &w,
+        [](auto const& entry, Widget const* p) { return entry.first < p; });
+    if (at == std::end(by_address_) || at->first != &w)
+        return npos;
+    return at->second;
+}
+
+auto Render_list::widget_at(Point p) const -> Widget*
+{
+    // The last hit in pre-order is the topmost, each subtree is only
+    // entered if its root is hit.
+    auto owner     = npos;
+    auto const end = static_cast<Index>(widgets_.size());
+    for (auto i = Index{0}; i < end;) {
+        if (this->is_enabled(i) && inners_[i].contains(p)) {
+            owner = i;
+            ++i;
+        }
+        else
+            i = subtree_ends_[i];
+    }
+    return owner == npos ? nullptr : widgets_[owner];
+}
+
+auto Render_list::empty_space(Index i) const -> Screen_mask
+{
+    auto const& area = inners_[i].area;
+    auto heights     = 0uL;
+    auto widths      = 0uL;
+    auto all_widths  = true;
+    auto all_heights = true;
+    for (auto c = i + 1; c < subtree_ends_[i]; c = subtree_ends_[c]) {
+        if (!this->is_enabled(c))
+            continue;
+        auto const& child = outers_[c].area;
+        heights += child.height;
+        widths += child.width;
+        all_widths  = all_widths && child.width == area.width;
+        all_heights = all_heights && child.height == area.height;
+    }
+    if ((heights == area.height && all_widths) ||
+        (widths == area.width && all_heights)) {
+        return {};
+    }
+    auto mask = Screen_mask{inners_[i].top_left, area};
+    for (auto c = i + 1; c < subtree_ends_[i]; c = subtree_ends_[c]) {
+        if (!this->is_enabled(c))
+            continue;
+        auto const& [top_left, child] = outers_[c];
+        for (auto y = top_left.y; y < top_left.y + child.height; ++y) {
+            for (auto x = top_left.x; x < top_left.x + child.width; ++x)
+                mask.at(x, y) = true;
+        }
+    }
+    mask.flip();
+    return mask;
+}
+
+auto Render_list::current() -> Render_list const&
+{
+    static auto list = Render_list{};
+    if (!is_valid_.exchange(true)) {
+        if (auto* const head = System::head(); head != nullptr)
+            list.build(*head);
+        else
+            list.clear();
+    }
+    return list;
+}
+
+void Render_list::append(Widget& w, Index parent, Index depth)
+{
+    auto const index = static_cast<Index>(widgets_.size());
+    widgets_.push_back(&w);
+    parents_.push_back(parent);
+    depths_.push_back(depth);
+    subtree_ends_.push_back(index + 1);
+    outers_.push_back({w.top_left(), w.outer_area()});
+    inners_.push_back({w.inner_top_left(), w.area()});
+    flags_.push_back(static_cast<std::uint8_t>(
+        (w.is_enabled() ? Enabled : 0) |
+        (detail::is_paintable(w) ? Paintable : 0)));
+    by_address_.push_back({&w, index});
+    for (auto& child : w.get_children())
+        this->append(child, index, depth + 1);
+    subtree_ends_[index] = static_cast<Index>(widgets_.size());
+}
+
+}  // namespace ox::detail
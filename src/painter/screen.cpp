@@ -7,6 +7,7 @@
 #include <termox/painter/color.hpp>
 #include <termox/painter/detail/find_empty_space.hpp>
 #include <termox/painter/detail/is_paintable.hpp>
+#include <termox/painter/detail/render_list.hpp>
 #include <termox/painter/detail/screen_descriptor.hpp>
 #include <termox/painter/detail/screen_mask.hpp>
 #include <termox/painter/detail/staged_changes.hpp>
@@ -35,7 +36,7 @@ auto has_children(Widget const& widg) -> bool
 }
 
 /// Covers space unowned by any child widget with wallpaper.
-void paint_unowned_tiles(Widget const& layout, Glyph wallpaper)
+void paint_unowned_tiles(Widget& layout, Glyph wallpaper)
 {
     auto const empty_space = detail::find_empty_space(layout);
     auto const y_begin     = empty_space.offset().y;
@@ -87,12 +88,14 @@ auto cursor_is_within_area(Cursor const& cursor, Area const& a) -> bool
     return cursor.x() < a.width && cursor.y() < a.height;
 }
 
-auto has_valid_cursor(Widget const* w) -> bool
+/// Return true if \p w is on screen and its enabled cursor is within it.
+auto has_valid_cursor(Widget const& w,
+                      detail::Render_list const& list,
+                      detail::Render_list::Index i) -> bool
 {
-    if (w == nullptr)
-        return false;
-    return w->cursor.enabled() && detail::is_paintable(*w) &&
-           cursor_is_within_area(w->cursor, w->area());
+    return w.cursor.enabled() && i != detail::Render_list::npos &&
+           list.is_paintable(i) &&
+           cursor_is_within_area(w.cursor, list.inner(i).area);
 }
 
 void remove_cursor() { System::terminal.show_cursor(false); }
@@ -105,7 +108,7 @@ void Screen::flush(Staged_changes::Map_t const& changes)
 {
     auto refresh = false;
     for (auto const& widg_description : changes) {
-        auto& widget = *widg_description.first;
+        auto& widget = *widg_description.first.widget;
         if (is_paintable(widget)) {
             paint_to_terminal(widget, widg_description.second);
             refresh = true;
@@ -120,8 +123,12 @@ void Screen::flush(Staged_changes::Map_t const& changes)
 void Screen::display_cursor()
 {
     auto const* focus = detail::Focus::focus_widget();
-    if (has_valid_cursor(focus))
-        set_cursor(focus->inner_top_left(), focus->cursor);
+    if (focus == nullptr)
+        return remove_cursor();
+    auto const& list = Render_list::current();
+    auto const i     = list.find(*focus);
+    if (has_valid_cursor(*focus, list, i))
+        set_cursor(list.inner(i).top_left, focus->cursor);
     else
         remove_cursor();
 }
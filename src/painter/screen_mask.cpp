@@ -1,5 +1,6 @@
 #include <termox/painter/detail/screen_mask.hpp>
 
+#include <termox/system/detail/frame_arena.hpp>
 #include <termox/widget/area.hpp>
 #include <termox/widget/point.hpp>
 #include <termox/widget/widget.hpp>
@@ -28,7 +29,13 @@ namespace ox::detail {
 Screen_mask::Screen_mask(Widget const& w, Constructor_tag tag)
     : offset_{make_offset(w, tag)},
       area_{make_area(w, tag)},
-      bits_(area_.width * area_.height)
+      bits_(area_.width * area_.height, false, Frame_arena::resource())
+{}
+
+Screen_mask::Screen_mask(Point offset, Area area)
+    : offset_{offset},
+      area_{area},
+      bits_(area_.width * area_.height, false, Frame_arena::resource())
 {}
 
 }  // namespace ox::detail
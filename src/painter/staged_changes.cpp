@@ -0,0 +1,141 @@
+#include <termox/painter/detail/staged_changes.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+#include <termox/widget/widget.hpp>
+
+namespace {
+using ox::Widget;
+using ox::detail::Staged_changes;
+
+/// A tombstone and the Arena it was left in, nullptr if that has exited.
+struct Tombstone {
+    Staged_changes::Arena const* origin;
+    Staged_changes::Key key;
+};
+
+/// Every thread's Arena, so the flushing thread can find them.
+/** Locked before any Arena is, never while holding one. */
+struct Registry {
+    std::mutex mtx;
+    std::vector<Staged_changes::Arena*> arenas;
+    // Left by threads that exited before their changes were collected.
+    Staged_changes::Map_t orphaned;
+    // Gathered by collect(), also left by threads that exited.
+    std::vector<Tombstone> tombstones;
+
+    // Read by discard() without the lock.
+    std::atomic<std::size_t> arena_count = 0uL;
+    std::atomic<bool> has_orphans        = false;
+};
+
+/// Apply each of the changes in \p from over \p to.
+void merge_changes(Staged_changes::Map_t const& from,
+                   Staged_changes::Map_t& to)
+{
+    for (auto const& [key, changes] : from) {
+        auto& merged = to[key];
+        for (auto const& [point, glyph] : changes)
+            merged[point] = glyph;
+    }
+}
+
+/// Erase the changes of each tombstone not left by \p arena from \p changes.
+void apply_tombstones(std::vector<Tombstone> const& tombstones,
+                      Staged_changes::Arena const* arena,
+                      Staged_changes::Map_t& changes)
+{
+    for (auto const [origin, key] : tombstones) {
+        if (origin != arena || origin == nullptr)
+            changes.erase(key);
+    }
+}
+
+// Constructed by the first Arena, so it is destroyed after the last Arena.
+auto registry() -> Registry&
+{
+    static auto r = Registry{};
+    return r;
+}
+
+}  // namespace
+
+namespace ox::detail {
+
+Staged_changes::Arena::Arena()
+    : pool{std::pmr::pool_options{0uL, 1'024uL * 1'024uL}}
+{
+    auto& r         = registry();
+    auto const lock = std::scoped_lock{r.mtx};
+    r.arenas.push_back(this);
+    r.arena_count.store(r.arenas.size());
+}
+
+Staged_changes::Arena::~Arena()
+{
+    auto& r         = registry();
+    auto const lock = std::scoped_lock{r.mtx};
+    r.arenas.erase(std::find(std::begin(r.arenas), std::end(r.arenas), this));
+    r.arena_count.store(r.arenas.size());
+    merge_changes(changes, r.orphaned);
+    if (!r.orphaned.empty())
+        r.has_orphans.store(true);
+    for (auto const key : tombstones)
+        r.tombstones.push_back({nullptr, key});
+}
+
+auto Staged_changes::collect() -> Map_t&
+{
+    auto& self      = local();
+    auto& r         = registry();
+    auto const lock = std::scoped_lock{r.mtx};
+
+    // Every tombstone is gathered before any Arena is merged, so a Widget
+    // destroyed on one thread is not merged from another thread's Arena.
+    for (Arena* arena : r.arenas) {
+        auto const arena_lock = std::scoped_lock{arena->mtx};
+        for (auto const key : arena->tombstones)
+            r.tombstones.push_back({arena, key});
+        arena->tombstones.clear();
+    }
+    if (r.has_orphans.load()) {
+        apply_tombstones(r.tombstones, nullptr, r.orphaned);
+        merge_changes(r.orphaned, self.changes);
+        r.orphaned.clear();
+        r.has_orphans.store(false);
+    }
+    for (Arena* arena : r.arenas) {
+        auto const arena_lock = std::scoped_lock{arena->mtx};
+        apply_tombstones(r.tombstones, arena, arena->changes);
+        if (arena == &self)
+            continue;
+        merge_changes(arena->changes, self.changes);
+        arena->changes.clear();
+    }
+    r.tombstones.clear();
+    return self.changes;
+}
+
+auto Staged_changes::key(Widget const& w) -> Key
+{
+    return {const_cast<Widget*>(&w), w.unique_id()};
+}
+
+void Staged_changes::discard(Widget const& w)
+{
+    auto const k          = key(w);
+    auto& self            = local();
+    auto const arena_lock = std::scoped_lock{self.mtx};
+    self.changes.erase(k);
+    auto& r = registry();
+    if (r.arena_count.load() > 1uL || r.has_orphans.load())
+        self.tombstones.push_back(k);
+}
+
+}  // namespace ox::detail
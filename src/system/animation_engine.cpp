@@ -1,21 +1,25 @@
 #include <termox/system/animation_engine.hpp>
 
-#include <algorithm>
 #include <iterator>
-#include <memory>
 
-#include <termox/system/detail/timer_event_loop.hpp>
+#include <termox/painter/detail/is_paintable.hpp>
+#include <termox/system/event.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/widget.hpp>
 
 namespace ox {
 
 void Animation_engine::register_widget(Widget& w, Period_t interval)
 {
-    if (!this->has_loop_with(interval)) {
-        loops_.emplace_back(
-            std::make_unique<detail::Timer_event_loop>(interval));
-        loops_.back()->run_async();
+    auto const [iter, inserted] = registered_.insert({&w, {interval}});
+    if (!inserted) {
+        scheduler_.cancel(iter->second.timer);
+        iter->second = Registration{interval};
     }
-    this->get_loop_with(interval).register_widget(w);
+    else
+        w.destroyed.connect([this, &w] { this->unregister_widget(w); });
+    iter->second.is_suspended = !detail::is_paintable(w);
+    this->sync_timer(w, iter->second);
 }
 
 void Animation_engine::register_widget(Widget& w, FPS fps)
@@ -25,36 +29,59 @@ void Animation_engine::register_widget(Widget& w, FPS fps)
 
 void Animation_engine::unregister_widget(Widget& w)
 {
-    // Unregister the Widget from the event loop it is contained in, and return
-    // that event loop.
-    auto const iter = std::find_if(
-        std::begin(loops_), std::end(loops_),
-        [&w](auto const& loop) { return loop->unregister_widget(w); });
-
-    // If an event loop was found, and it is now empty, shutdown that event loop
-    if (iter != std::end(loops_)) {
-        if (auto& loop = *iter; loop->is_empty()) {
-            loop->exit(0);
-            loop->wait();
-            loops_.erase(iter);
-        }
-    }
+    auto const iter = registered_.find(&w);
+    if (iter == std::end(registered_))
+        return;
+    scheduler_.cancel(iter->second.timer);
+    registered_.erase(iter);
+}
+
+void Animation_engine::update_visibility(Widget& w)
+{
+    auto const iter = registered_.find(&w);
+    if (iter == std::end(registered_))
+        return;
+    auto const is_suspended = !detail::is_paintable(w);
+    if (iter->second.is_suspended == is_suspended)
+        return;
+    iter->second.is_suspended = is_suspended;
+    this->sync_timer(w, iter->second);
 }
 
 void Animation_engine::shutdown()
 {
-    /* Timer_event_loops will wait on the future at destruction.
-     * Because shutdown is called from Event_loop and will wait forever. */
-    for (auto& loop : loops_) {
-        loop->exit(0);
-        loop->wait();
-    }
+    is_running_ = false;
+    for (auto& [widget, registration] : registered_)
+        this->sync_timer(*widget, registration);
 }
 
 void Animation_engine::startup()
 {
-    for (auto& loop : loops_)
-        loop->run_async();
+    if (is_running_)
+        return;
+    is_running_ = true;
+    for (auto& [widget, registration] : registered_)
+        this->sync_timer(*widget, registration);
+}
+
+auto Animation_engine::start_timer(Widget& w, Period_t period)
+    -> Timer_scheduler::Id
+{
+    return scheduler_.add_repeating(period, [&w] {
+        if (!System::exit_requested())
+            System::post_event(Timer_event{w});
+    });
+}
+
+void Animation_engine::sync_timer(Widget& w, Registration& registration)
+{
+    auto const should_run = is_running_ && !registration.is_suspended;
+    if (should_run && registration.timer == 0)
+        registration.timer = this->start_timer(w, registration.period);
+    else if (!should_run && registration.timer != 0) {
+        scheduler_.cancel(registration.timer);
+        registration.timer = 0;
+    }
 }
 
 }  // namespace ox
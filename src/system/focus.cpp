@@ -2,8 +2,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iterator>
-#include <memory>
 #include <utility>
 #include <vector>
 
@@ -26,47 +26,110 @@ auto is_click_focus_policy(Focus_policy policy) -> bool
     return policy == Focus_policy::Strong || policy == Focus_policy::Click;
 }
 
-auto const is_tab_focusable = [](auto const* widg) {
-    return widg->is_enabled() && is_tab_focus_policy(widg->focus_policy);
-};
-
-// Return a widg tree from System::head() if focus_widget is nullptr.
-auto gen_focus_front_widg_tree() -> std::vector<ox::Widget*>
+auto is_tab_focusable(Widget const& w) -> bool
 {
-    auto widg_tree = System::head()->get_descendants();
-    widg_tree.insert(std::begin(widg_tree), System::head());
-    auto* const focus_widg = Focus::focus_widget();
-    if (focus_widg != nullptr) {
-        auto const begin = std::begin(widg_tree);
-        auto const end   = std::end(widg_tree);
-        auto const iter  = std::find(begin, end, focus_widg);
-        if (iter != end)
-            std::rotate(begin, iter, end);
-    }
-    return widg_tree;
+    return w.is_enabled() && is_tab_focus_policy(w.focus_policy);
 }
 
-auto next_tab_focus() -> ox::Widget*
-{
-    if (System::head() == nullptr)
-        return nullptr;
-    auto const widg_tree  = gen_focus_front_widg_tree();
-    auto const begin      = std::next(std::begin(widg_tree));
-    auto const end        = std::end(widg_tree);
-    auto const next_focus = std::find_if(begin, end, is_tab_focusable);
-    return (next_focus != end) ? *next_focus : Focus::focus_widget();
-}
+/// The Tab focusable Widgets under System::head(), in depth-first order.
+/** Rebuilt on the first Tab press after Focus::invalidate_tab_chain(), each
+ *  press in between finds the next Widget without walking the tree. */
+class Tab_chain {
+   public:
+    /// Return the next Tab focusable Widget after the current focus Widget.
+    /** Wraps at the end. Returns the focus Widget if no other Widget is
+     *  focusable. */
+    auto next() -> Widget*
+    {
+        auto const [at, is_focusable] = this->find_focus();
+        if (chain_.empty())
+            return Focus::focus_widget();
+        auto const n = is_focusable ? at + 1uL : at;
+        return this->at(n % chain_.size());
+    }
 
-auto previous_tab_focus() -> ox::Widget*
-{
-    if (System::head() == nullptr)
-        return nullptr;
-    auto const widg_tree      = gen_focus_front_widg_tree();
-    auto const begin          = std::rbegin(widg_tree);
-    auto const end            = std::rend(widg_tree);
-    auto const previous_focus = std::find_if(begin, end, is_tab_focusable);
-    return previous_focus != end ? *previous_focus : Focus::focus_widget();
-}
+    /// Return the previous Tab focusable Widget before the focus Widget.
+    /** As next(), in reverse. */
+    auto previous() -> Widget*
+    {
+        auto const at = this->find_focus().first;
+        if (chain_.empty())
+            return Focus::focus_widget();
+        return this->at((at + chain_.size() - 1uL) % chain_.size());
+    }
+
+    /// Rebuild the chain on the next call to next() or previous().
+    void invalidate() { is_valid_ = false; }
+
+   private:
+    /// Position of a Widget in the tree, as an index into chain_.
+    struct Position {
+        Widget const* widget;
+        std::size_t chain_index;  // Of the first chain_ Widget at or after.
+        bool is_focusable;
+    };
+
+    std::vector<Widget*> chain_;
+    std::vector<Position> positions_;  // Sorted by widget address.
+    std::size_t last_ = 0uL;           // Index of the last Widget returned.
+    bool is_valid_    = false;
+
+   private:
+    auto at(std::size_t i) -> Widget*
+    {
+        last_ = i;
+        return chain_[i];
+    }
+
+    /// Return the chain_ index of the focus Widget, and if it is in chain_.
+    /** The head Widget stands in for a focus Widget outside of the tree. */
+    auto find_focus() -> std::pair<std::size_t, bool>
+    {
+        if (!is_valid_)
+            this->build(*System::head());
+        auto const* const focus = Focus::focus_widget();
+        if (last_ < chain_.size() && chain_[last_] == focus)
+            return {last_, true};
+        auto const* found = this->find(focus);
+        if (found == nullptr)
+            found = this->find(System::head());
+        return {found->chain_index, found->is_focusable};
+    }
+
+    auto find(Widget const* w) const -> Position const*
+    {
+        auto const iter = std::lower_bound(
+            std::begin(positions_), std::end(positions_), w,
+            [](Position const& p, Widget const* w) {
+                return std::less<>{}(p.widget, w);
+            });
+        if (iter == std::end(positions_) || iter->widget != w)
+            return nullptr;
+        return &*iter;
+    }
+
+    void build(Widget& head)
+    {
+        chain_.clear();
+        positions_.clear();
+        last_ = 0uL;
+        auto const append = [this](Widget& w) {
+            auto const is_focusable = is_tab_focusable(w);
+            positions_.push_back({&w, chain_.size(), is_focusable});
+            if (is_focusable)
+                chain_.push_back(&w);
+        };
+        append(head);
+        head.for_each_descendant(append);
+        std::sort(std::begin(positions_), std::end(positions_),
+                  [](Position const& a, Position const& b) {
+                      return std::less<>{}(a.widget, b.widget);
+                  });
+        is_valid_ = true;
+    }
+};
+
+auto tab_chain = Tab_chain{};
 
 }  // namespace
 
@@ -76,6 +139,8 @@ ox::Widget* Focus::focus_widget_ = nullptr;
 bool Focus::tab_enabled_         = true;
 bool Focus::tab_suppressed_      = false;
 
+void Focus::invalidate_tab_chain() { tab_chain.invalidate(); }
+
 void Focus::mouse_press(ox::Widget& clicked)
 {
     if (&clicked == focus_widget_)
@@ -87,7 +152,8 @@ void Focus::mouse_press(ox::Widget& clicked)
 auto Focus::tab_press() -> bool
 {
     if (tab_enabled_ && !tab_suppressed_) {
-        auto* next = next_tab_focus();
+        auto* next =
+            System::head() == nullptr ? nullptr : tab_chain.next();
         if (next == nullptr)
             Focus::clear();
         else
@@ -101,7 +167,8 @@ auto Focus::tab_press() -> bool
 auto Focus::shift_tab_press() -> bool
 {
     if (tab_enabled_ && !tab_suppressed_) {
-        auto* previous = previous_tab_focus();
+        auto* previous =
+            System::head() == nullptr ? nullptr : tab_chain.previous();
         if (previous == nullptr)
             Focus::clear();
         else
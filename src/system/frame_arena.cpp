@@ -0,0 +1,130 @@
+#include <termox/system/detail/frame_arena.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace {
+
+/// Heap resource that counts the bytes requested from it.
+class Overflow_resource : public std::pmr::memory_resource {
+   public:
+    std::size_t requested = 0uL;
+
+   private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override
+    {
+        requested += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p,
+                       std::size_t bytes,
+                       std::size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    auto do_is_equal(std::pmr::memory_resource const& other) const noexcept
+        -> bool override
+    {
+        return this == &other;
+    }
+};
+
+/// Forwards to a monotonic buffer, counting allocations not yet deallocated.
+/** Every container using the frame buffer must be destroyed before the frame
+ *  ends, end_frame() asserts this in debug builds. */
+class Counting_resource : public std::pmr::memory_resource {
+   public:
+    std::pmr::memory_resource* upstream = nullptr;
+    std::size_t live                    = 0uL;
+
+   private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override
+    {
+        ++live;
+        return upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p,
+                       std::size_t bytes,
+                       std::size_t alignment) override
+    {
+        --live;
+        upstream->deallocate(p, bytes, alignment);
+    }
+
+    auto do_is_equal(std::pmr::memory_resource const& other) const noexcept
+        -> bool override
+    {
+        return this == &other;
+    }
+};
+
+/// The buffer used by the thread running the Event_engine.
+struct Frame_buffer {
+    std::size_t size = 16 * 1'024;
+    std::unique_ptr<std::byte[]> memory;
+    Overflow_resource overflow;
+    std::optional<std::pmr::monotonic_buffer_resource> monotonic;
+    Counting_resource counting;
+
+    /// Allocate memory of the current size and start a fresh monotonic.
+    void reset()
+    {
+        monotonic.reset();
+        memory             = std::make_unique<std::byte[]>(size);
+        overflow.requested = 0uL;
+        monotonic.emplace(memory.get(), size, &overflow);
+        counting.upstream = &*monotonic;
+    }
+};
+
+auto frame_buffer() -> Frame_buffer&
+{
+    static auto buffer = Frame_buffer{};
+    return buffer;
+}
+
+thread_local bool is_in_frame = false;
+
+}  // namespace
+
+namespace ox::detail {
+
+auto Frame_arena::resource() -> std::pmr::memory_resource*
+{
+    if (is_in_frame)
+        return &frame_buffer().counting;
+    return std::pmr::new_delete_resource();
+}
+
+void Frame_arena::begin_frame()
+{
+    auto& buffer = frame_buffer();
+    if (!buffer.monotonic.has_value())
+        buffer.reset();
+    is_in_frame = true;
+}
+
+void Frame_arena::end_frame()
+{
+    is_in_frame  = false;
+    auto& buffer = frame_buffer();
+    assert(buffer.counting.live == 0uL &&
+           "Frame_arena memory was kept past the end of the frame.");
+    buffer.counting.live = 0uL;
+    if (buffer.overflow.requested == 0uL) {
+        buffer.monotonic->release();
+        return;
+    }
+    // Grow geometrically so overflowing frames, and reallocation, are rare.
+    auto const needed = buffer.size + buffer.overflow.requested;
+    buffer.size       = needed > buffer.size * 2uL ? needed : buffer.size * 2uL;
+    buffer.reset();
+}
+
+}  // namespace ox::detail
@@ -0,0 +1,52 @@
+#include <termox/system/frame_clock.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace ox {
+
+auto Frame_clock::on_frame(Callback_t fn) -> Id
+{
+    auto const id = next_id_++;
+    (is_ticking_ ? added_ : callbacks_).push_back({id, std::move(fn)});
+    return id;
+}
+
+void Frame_clock::remove(Id id)
+{
+    auto const has_id = [id](Entry const& e) { return e.id == id; };
+    auto const iter =
+        std::find_if(std::begin(callbacks_), std::end(callbacks_), has_id);
+    if (iter != std::end(callbacks_)) {
+        // The callback might be running, it is erased at the end of tick().
+        if (is_ticking_)
+            iter->id = 0;
+        else
+            callbacks_.erase(iter);
+        return;
+    }
+    added_.erase(std::remove_if(std::begin(added_), std::end(added_), has_id),
+                 std::end(added_));
+}
+
+void Frame_clock::tick(Clock_t::time_point now)
+{
+    auto const dt = now - last_frame_;
+    last_frame_   = now;
+    is_ticking_   = true;
+    for (auto& entry : callbacks_) {
+        if (entry.id != 0)
+            entry.fn(dt);
+    }
+    is_ticking_ = false;
+    callbacks_.erase(std::remove_if(std::begin(callbacks_),
+                                    std::end(callbacks_),
+                                    [](Entry const& e) { return e.id == 0; }),
+                     std::end(callbacks_));
+    std::move(std::begin(added_), std::end(added_),
+              std::back_inserter(callbacks_));
+    added_.clear();
+}
+
+}  // namespace ox
@@ -11,6 +11,7 @@
 
 #include <signals_light/signal.hpp>
 
+#include <termox/painter/detail/render_list.hpp>
 #include <termox/system/animation_engine.hpp>
 #include <termox/system/detail/event_engine.hpp>
 #include <termox/system/detail/event_queue.hpp>
@@ -21,7 +22,9 @@
 #include <termox/system/detail/user_input_event_loop.hpp>
 #include <termox/system/event.hpp>
 #include <termox/system/event_loop.hpp>
+#include <termox/system/frame_clock.hpp>
 #include <termox/system/system.hpp>
+#include <termox/system/thread_pool.hpp>
 #include <termox/terminal/terminal.hpp>
 #include <termox/widget/area.hpp>
 #include <termox/widget/widget.hpp>
@@ -38,6 +41,31 @@ void System::enable_tab_focus() { detail::Focus::enable_tab_focus(); }
 
 void System::disable_tab_focus() { detail::Focus::disable_tab_focus(); }
 
+System::Batch::Batch() { System::event_engine().queue().begin_batch(); }
+
+System::Batch::~Batch() { System::event_engine().queue().end_batch(); }
+
+auto System::Batch::is_active() -> bool
+{
+    return System::event_engine().queue().is_batching();
+}
+
+void System::Batch::defer(Widget& w, void (*update)(Widget&))
+{
+    System::event_engine().queue().defer_layout(w, update);
+}
+
+void System::Batch::cancel(Widget& w)
+{
+    System::event_engine().queue().cancel_layout(w);
+}
+
+auto System::thread_pool() -> Thread_pool&
+{
+    static auto pool = Thread_pool{};
+    return pool;
+}
+
 void System::post_event(Event e)
 {
     System::event_engine().queue().append(std::move(e));
@@ -54,6 +82,8 @@ void System::set_head(Widget* new_head)
     if (head_ != nullptr)
         head_->disable();
     head_ = new_head;
+    detail::Render_list::invalidate();
+    detail::Focus::invalidate_tab_chain();
 }
 
 auto System::run() -> int
@@ -71,33 +101,37 @@ auto System::run() -> int
 
 void System::send_event(Event e)
 {
-    if (!std::visit([](auto const& e) { return detail::is_sendable(e); }, e))
-        return;
-    auto const handled =
-        std::visit([](auto const& e) { return detail::filter_send(e); }, e);
-    if (!handled)
-        std::visit([](auto e) { detail::send(std::move(e)); }, std::move(e));
+    std::visit(
+        [](auto& e) {
+            if (!detail::is_sendable(e))
+                return;
+            if (detail::has_filter_stage(e) && detail::filter_send(e))
+                return;
+            detail::send(std::move(e));
+        },
+        e);
 }
 
 void System::send_event(Paint_event e)
 {
     if (!detail::is_sendable(e))
         return;
-    auto const handled = detail::filter_send(e);
-    if (!handled)
-        detail::send(std::move(e));
+    if (detail::has_filter_stage(e) && detail::filter_send(e))
+        return;
+    detail::send(std::move(e));
 }
 
-void System::send_event(Delete_event e)
+auto System::send_event(Delete_event e) -> std::unique_ptr<Widget>
 {
-    auto const handled = detail::filter_send(e);
-    if (!handled)
-        detail::send(std::move(e));
+    if (detail::has_filter_stage(e) && detail::filter_send(e))
+        return std::move(e.removed);
+    return detail::send(std::move(e));
 }
 
 sl::Slot<void()> System::quit = [] { System::exit(); };
 detail::Event_engine System::event_engine_;
 Animation_engine System::animation_engine_;
+Frame_clock System::frame_clock_;
 
 // GCC requires this here, it can't find the default constructor when it's in
 // system.hpp for whatever reason...
@@ -0,0 +1,58 @@
+#include <termox/system/thread_pool.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace ox {
+
+Thread_pool::Thread_pool(std::size_t thread_count)
+{
+    thread_count = std::max(thread_count, std::size_t{1});
+    workers_.reserve(thread_count);
+    for (auto i = 0uL; i < thread_count; ++i)
+        workers_.emplace_back([this] { this->run(); });
+}
+
+Thread_pool::~Thread_pool()
+{
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        stop_           = true;
+        tasks_.clear();
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_)
+        worker.join();
+}
+
+void Thread_pool::submit(Task_t task)
+{
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        tasks_.push_back(std::move(task));
+    }
+    wake_.notify_one();
+}
+
+auto Thread_pool::default_size() -> std::size_t
+{
+    auto const hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? hardware - 1 : 1;
+}
+
+void Thread_pool::run()
+{
+    auto lock = std::unique_lock{mtx_};
+    while (true) {
+        wake_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+        if (stop_)
+            return;
+        auto task = std::move(tasks_.front());
+        tasks_.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+}  // namespace ox
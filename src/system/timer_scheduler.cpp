@@ -0,0 +1,125 @@
+#include <termox/system/timer_scheduler.hpp>
+
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <termox/system/event.hpp>
+#include <termox/system/system.hpp>
+
+namespace {
+using namespace ox;
+
+/// Wrap \p fn so that each call posts it to the main thread.
+auto posting(std::shared_ptr<Timer_scheduler::Callback_t> fn)
+    -> Timer_scheduler::Callback_t
+{
+    return [fn = std::move(fn)] {
+        System::post_event(Custom_event{[fn] { (*fn)(); }});
+    };
+}
+
+}  // namespace
+
+namespace ox {
+
+auto Timer_scheduler::get() -> Timer_scheduler&
+{
+    static auto scheduler = Timer_scheduler{};
+    return scheduler;
+}
+
+Timer_scheduler::~Timer_scheduler()
+{
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        stop_           = true;
+    }
+    wake_.notify_one();
+    if (thread_.joinable())
+        thread_.join();
+}
+
+auto Timer_scheduler::add_one_shot(Period_t delay, Callback_t fn) -> Id
+{
+    return this->add(delay, delay, false, std::move(fn));
+}
+
+auto Timer_scheduler::add_repeating(Period_t period, Callback_t fn) -> Id
+{
+    return this->add(period, period, true, std::move(fn));
+}
+
+auto Timer_scheduler::post_after(Period_t delay, Callback_t fn) -> Id
+{
+    return this->add_one_shot(
+        delay, posting(std::make_shared<Callback_t>(std::move(fn))));
+}
+
+auto Timer_scheduler::post_every(Period_t period, Callback_t fn) -> Id
+{
+    return this->add_repeating(
+        period, posting(std::make_shared<Callback_t>(std::move(fn))));
+}
+
+void Timer_scheduler::cancel(Id id)
+{
+    auto const lock = std::scoped_lock{mtx_};
+    timers_.erase(id);
+}
+
+auto Timer_scheduler::add(Period_t delay,
+                          Period_t period,
+                          bool repeats,
+                          Callback_t fn) -> Id
+{
+    auto const lock = std::scoped_lock{mtx_};
+    auto const id   = next_id_++;
+    timers_.emplace(
+        id, Timer{period, repeats, std::make_shared<Callback_t>(std::move(fn))});
+    deadlines_.push({Clock_t::now() + delay, id});
+    if (!thread_.joinable())
+        thread_ = std::thread{[this] { this->run(); }};
+    else if (deadlines_.top().id == id)
+        wake_.notify_one();
+    return id;
+}
+
+void Timer_scheduler::run()
+{
+    auto lock = std::unique_lock{mtx_};
+    while (!stop_) {
+        if (deadlines_.empty()) {
+            wake_.wait(lock);
+            continue;
+        }
+        auto const next = deadlines_.top();
+        auto const iter = timers_.find(next.id);
+        if (iter == std::end(timers_)) {  // Cancelled.
+            deadlines_.pop();
+            continue;
+        }
+        auto const now = Clock_t::now();
+        if (now < next.when) {
+            wake_.wait_until(lock, next.when);
+            continue;
+        }
+        deadlines_.pop();
+        auto const fn = iter->second.fn;
+        if (iter->second.repeats) {
+            auto const period = iter->second.period;
+            auto when         = next.when + period;
+            if (when <= now)
+                when = now + period;
+            deadlines_.push({when, next.id});
+        }
+        else
+            timers_.erase(iter);
+        lock.unlock();
+        (*fn)();
+        lock.lock();
+    }
+}
+
+}  // namespace ox
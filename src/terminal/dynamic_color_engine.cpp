@@ -1,5 +1,7 @@
 #include <termox/terminal/dynamic_color_engine.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -9,37 +11,122 @@
 #include <termox/system/system.hpp>
 #include <termox/terminal/output.hpp>
 
-namespace ox::detail {
-
 namespace {
+using namespace ox;
 
 using Processed_colors = std::vector<std::pair<ANSI, True_color>>;
 
 /// Create a Custom_event to update color definitions.
 auto dynamic_color_event(Processed_colors colors) -> Custom_event
 {
-    return {[=] {
-        {
-            for (auto& [ansi, true_color] : colors)
-                System::terminal.term_set_color(ansi, true_color);
-        }
+    return {[colors = std::move(colors)] {
+        for (auto& [ansi, true_color] : colors)
+            System::terminal.term_set_color(ansi, true_color);
         ox::output::refresh();
     }};
 }
 
 }  // namespace
 
-void Dynamic_color_event_loop::loop_function()
+namespace ox {
+
+void Dynamic_color_engine::register_color(ANSI ansi,
+                                          Dynamic_color const& dynamic)
 {
     {
-        auto processed   = Processed_colors{};
-        auto const guard = std::scoped_lock{colors_mtx_};
-        for (auto& [ansi, dynamic] : colors_)
+        auto const lock = std::scoped_lock{mtx_};
+        this->remove_color(ansi);
+        auto const group = std::find_if(
+            std::begin(groups_), std::end(groups_),
+            [&](auto const& g) { return g.interval == dynamic.interval; });
+        if (group != std::end(groups_))
+            group->colors.push_back({ansi, dynamic});
+        else {
+            groups_.push_back({dynamic.interval, {{ansi, dynamic}}});
+            if (is_running_)
+                groups_.back().timer = this->start_timer(dynamic.interval);
+        }
+    }
+    // Set the initial value without waiting for the first interval.
+    this->post_colors(dynamic.interval);
+}
+
+void Dynamic_color_engine::unregister_color(ANSI ansi)
+{
+    auto const lock = std::scoped_lock{mtx_};
+    this->remove_color(ansi);
+}
+
+void Dynamic_color_engine::clear()
+{
+    auto const lock = std::scoped_lock{mtx_};
+    for (auto const& group : groups_)
+        scheduler_.cancel(group.timer);
+    groups_.clear();
+}
+
+void Dynamic_color_engine::startup()
+{
+    auto const lock = std::scoped_lock{mtx_};
+    if (is_running_)
+        return;
+    for (auto& group : groups_)
+        group.timer = this->start_timer(group.interval);
+    is_running_ = true;
+}
+
+void Dynamic_color_engine::shutdown()
+{
+    auto const lock = std::scoped_lock{mtx_};
+    for (auto& group : groups_) {
+        scheduler_.cancel(group.timer);
+        group.timer = 0;
+    }
+    is_running_ = false;
+}
+
+void Dynamic_color_engine::post_colors(Period_t interval)
+{
+    if (System::exit_requested())
+        return;
+    auto processed = Processed_colors{};
+    {
+        auto const lock  = std::scoped_lock{mtx_};
+        auto const group = std::find_if(
+            std::begin(groups_), std::end(groups_),
+            [&](auto const& g) { return g.interval == interval; });
+        if (group == std::end(groups_))
+            return;
+        for (auto& [ansi, dynamic] : group->colors)
             processed.push_back({ansi, dynamic.get_value()});
+    }
+    System::post_event(dynamic_color_event(std::move(processed)));
+}
 
-        System::post_event(dynamic_color_event(processed));
+void Dynamic_color_engine::remove_color(ANSI ansi)
+{
+    for (auto group = std::begin(groups_); group != std::end(groups_);
+         ++group) {
+        auto& colors    = group->colors;
+        auto const iter = std::find_if(
+            std::begin(colors), std::end(colors),
+            [ansi](auto const& def) { return def.ansi == ansi; });
+        if (iter == std::end(colors))
+            continue;
+        colors.erase(iter);
+        if (colors.empty()) {
+            scheduler_.cancel(group->timer);
+            groups_.erase(group);
+        }
+        return;
     }
-    Interval_event_loop::loop_function();
 }
 
-}  // namespace ox::detail
+auto Dynamic_color_engine::start_timer(Period_t interval)
+    -> Timer_scheduler::Id
+{
+    return scheduler_.add_repeating(interval,
+                                    [this, interval] { this->post_colors(interval); });
+}
+
+}  // namespace ox
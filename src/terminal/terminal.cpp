@@ -294,8 +294,7 @@ void Terminal::repaint_all()
     auto* const head = System::head();
     if (head == nullptr)
         return;
-    for (auto* const d : head->get_descendants())
-        d->update();
+    head->for_each_descendant([](Widget& d) { d.update(); });
 }
 
 }  // namespace ox
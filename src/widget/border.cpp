@@ -2,10 +2,36 @@
 
 #include <cstddef>
 
+#include <termox/painter/detail/render_list.hpp>
 #include <termox/painter/glyph.hpp>
 
 namespace ox {
 
+// Segments change the inner area of the owning Widget.
+void Border::Segment::enable()
+{
+    enabled_ = true;
+    detail::Render_list::invalidate();
+}
+
+void Border::Segment::disable()
+{
+    enabled_ = false;
+    detail::Render_list::invalidate();
+}
+
+void Border::enable()
+{
+    enabled_ = true;
+    detail::Render_list::invalidate();
+}
+
+void Border::disable()
+{
+    enabled_ = false;
+    detail::Render_list::invalidate();
+}
+
 void Border::Segments::disable_all()
 {
     north.disable();
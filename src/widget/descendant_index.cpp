@@ -0,0 +1,119 @@
+#include <termox/widget/detail/descendant_index.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+
+#include <termox/widget/widget.hpp>
+
+namespace ox::detail {
+
+Descendant_index::Descendant_index(Widget& owner)
+{
+    ++live_count_;
+    for (Widget& d : owner.descendants_preorder())
+        this->insert(d);
+}
+
+Descendant_index::~Descendant_index() { --live_count_; }
+
+auto Descendant_index::named(std::string const& name) const -> Bucket_t const*
+{
+    auto const at = by_name_.find(name);
+    return at == std::end(by_name_) ? nullptr : &at->second;
+}
+
+void Descendant_index::child_inserted(Widget& child)
+{
+    if (live_count_ == 0uL)
+        return;
+    for (auto* a = child.parent(); a != nullptr; a = a->parent()) {
+        if (auto* const index = a->descendant_index(); index != nullptr)
+            index->insert_subtree(child);
+    }
+}
+
+void Descendant_index::child_removed(Widget& parent, Widget& child)
+{
+    if (live_count_ == 0uL)
+        return;
+    for (auto* a = &parent; a != nullptr; a = a->parent()) {
+        if (auto* const index = a->descendant_index(); index != nullptr)
+            index->erase_subtree(child);
+    }
+}
+
+void Descendant_index::renamed(Widget& w, std::string const& old_name)
+{
+    if (live_count_ == 0uL)
+        return;
+    for (auto* a = w.parent(); a != nullptr; a = a->parent()) {
+        if (auto* const index = a->descendant_index(); index != nullptr) {
+            index->erase_name(w, old_name);
+            index->insert_name(w, w.name());
+        }
+    }
+}
+
+void Descendant_index::insert_subtree(Widget& w)
+{
+    this->insert(w);
+    for (Widget& d : w.descendants_preorder())
+        this->insert(d);
+}
+
+void Descendant_index::erase_subtree(Widget& w)
+{
+    this->erase(w);
+    for (Widget& d : w.descendants_preorder())
+        this->erase(d);
+}
+
+void Descendant_index::insert(Widget& w)
+{
+    auto const type = std::type_index{typeid(w)};
+    auto& bucket    = by_type_[type];
+    if (!slots_.try_emplace(&w, Slot{type, bucket.size()}).second)
+        return;
+    bucket.push_back(&w);
+    this->insert_name(w, w.name());
+}
+
+void Descendant_index::erase(Widget& w)
+{
+    auto const slot = slots_.find(&w);
+    if (slot == std::end(slots_))
+        return;
+    auto const bucket = by_type_.find(slot->second.type);
+    auto& widgets     = bucket->second;
+    auto const at     = slot->second.at;
+    widgets[at]       = widgets.back();
+    slots_.at(widgets[at]).at = at;
+    widgets.pop_back();
+    if (widgets.empty())
+        by_type_.erase(bucket);
+    slots_.erase(slot);
+    this->erase_name(w, w.name());
+}
+
+void Descendant_index::insert_name(Widget& w, std::string const& name)
+{
+    if (!name.empty())
+        by_name_[name].push_back(&w);
+}
+
+void Descendant_index::erase_name(Widget& w, std::string const& name)
+{
+    auto const bucket = by_name_.find(name);
+    if (bucket == std::end(by_name_))
+        return;
+    auto& widgets = bucket->second;
+    widgets.erase(std::remove(std::begin(widgets), std::end(widgets), &w),
+                  std::end(widgets));
+    if (widgets.empty())
+        by_name_.erase(bucket);
+}
+
+}  // namespace ox::detail
@@ -157,7 +157,10 @@ auto Text_display::paint_event() -> bool
             case Align::Bottom:
             case Align::Right: start = this->width() - line.length; break;
         }
-        p.put(Glyph_string(sub_begin, sub_end), start, line_n++);
+        // Glyphs are put one at a time to avoid a Glyph_string per line.
+        for (auto i = sub_begin; i != sub_end; ++i)
+            p.put(*i, start++, line_n);
+        ++line_n;
     };
     auto const begin = std::begin(display_state_) + this->top_line();
     auto end         = std::end(display_state_);
@@ -1,6 +1,9 @@
 #include <termox/widget/widget.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -8,10 +11,15 @@
 #include <signals_light/signal.hpp>
 
 #include <termox/painter/brush.hpp>
+#include <termox/painter/detail/render_list.hpp>
+#include <termox/painter/detail/staged_changes.hpp>
 #include <termox/painter/glyph.hpp>
+#include <termox/system/detail/event_engine.hpp>
+#include <termox/system/detail/focus.hpp>
 #include <termox/system/event.hpp>
 #include <termox/system/system.hpp>
 #include <termox/terminal/terminal.hpp>
+#include <termox/widget/detail/descendant_index.hpp>
 
 namespace {
 
@@ -35,14 +43,38 @@ void post_child_polished(ox::Widget& w)
 
 namespace ox {
 
+void detail::size_policy_updated(Widget& owner) { post_child_polished(owner); }
+
 Widget::Widget(std::string name)
     : name_{std::move(name)}, unique_id_{get_unique_id()}
+{}
+
+Widget::~Widget()
+{
+    if (detail::Focus::focus_widget() == this)
+        detail::Focus::clear();
+    System::event_engine().queue().discard(*this);
+    detail::Staged_changes::discard(*this);
+    detail::Render_list::invalidate();
+    detail::Focus::invalidate_tab_chain();
+    if (event_filters_ != nullptr)
+        installed_filter_count_ -= event_filters_->size();
+}
+
+void Widget::set_name(std::string name)
 {
-    width_policy.policy_updated.connect([this] { post_child_polished(*this); });
-    height_policy.policy_updated.connect(
-        [this] { post_child_polished(*this); });
+    auto const old_name = std::exchange(name_, std::move(name));
+    detail::Descendant_index::renamed(*this, old_name);
 }
 
+void Widget::enable_descendant_index()
+{
+    if (descendant_index_ == nullptr)
+        descendant_index_ = std::make_unique<detail::Descendant_index>(*this);
+}
+
+void Widget::disable_descendant_index() { descendant_index_.reset(); }
+
 void Widget::enable(bool enable, bool post_child_polished_event)
 {
     this->enable_and_post_events(enable, post_child_polished_event);
@@ -51,7 +83,11 @@ void Widget::enable(bool enable, bool post_child_polished_event)
 }
 
 // Don't want to include system/event.hpp in widget.hpp
-void Widget::update() { System::post_event(Paint_event{*this}); }
+void Widget::update()
+{
+    if (!needs_paint_.load(std::memory_order_relaxed))
+        System::post_event(Paint_event{*this});
+}
 
 auto Widget::generate_wallpaper() const -> Glyph
 {
@@ -65,15 +101,32 @@ void Widget::install_event_filter(Widget& filter)
 {
     if (&filter == this)
         return;
-    auto const result = event_filters_.insert(&filter);
-    if (result.second) {  // if insert happened
-        // Remove filter from list on destruction of filter
-        auto remove_on_destroy = sl::Slot<void()>{
-            [this, &filter]() { this->remove_event_filter(filter); }};
-        // In case *this has been destroyed and the filter has not.
-        remove_on_destroy.track(this->lifetime);
-        filter.destroyed.connect(remove_on_destroy);
-    }
+    if (event_filters_ == nullptr)
+        event_filters_ = std::make_unique<Event_filters_t>();
+    auto const begin = std::begin(*event_filters_);
+    auto const end   = std::end(*event_filters_);
+    if (std::find(begin, end, &filter) != end)
+        return;
+    event_filters_->push_back(&filter);
+    ++installed_filter_count_;
+    // Remove filter from list on destruction of filter
+    auto remove_on_destroy = sl::Slot<void()>{
+        [this, &filter]() { this->remove_event_filter(filter); }};
+    // In case *this has been destroyed and the filter has not.
+    remove_on_destroy.track(this->lifetime);
+    filter.destroyed.connect(remove_on_destroy);
+}
+
+void Widget::remove_event_filter(Widget& filter)
+{
+    if (event_filters_ == nullptr)
+        return;
+    auto const end = std::end(*event_filters_);
+    auto const at  = std::find(std::begin(*event_filters_), end, &filter);
+    if (at == end)
+        return;
+    event_filters_->erase(at);
+    --installed_filter_count_;
 }
 
 void Widget::enable_and_post_events(bool enable, bool post_child_polished_event)
@@ -83,6 +136,10 @@ void Widget::enable_and_post_events(bool enable, bool post_child_polished_event)
     if (!enable)
         System::post_event(Disable_event{*this});
     enabled_ = enable;
+    detail::Render_list::invalidate();
+    detail::Focus::invalidate_tab_chain();
+    if (is_animated_)
+        System::animation_engine().update_visibility(*this);
     if (enable)
         System::post_event(Enable_event{*this});
     if (post_child_polished_event and this->parent() != nullptr)
@@ -0,0 +1,245 @@
+#include <termox/widget/widget_arena.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+/// Round \p size up to a multiple of the alignment of any Widget.
+auto constexpr aligned(std::size_t size) -> std::size_t
+{
+    auto constexpr align = alignof(std::max_align_t);
+    return (size + align - 1) / align * align;
+}
+
+/// Address range and owner of every block held by a Widget_arena.
+/** Finds the arena a Widget's memory came from, so allocations need no header
+ *  of their own. Lookups are skipped while no blocks are held. */
+class Block_map {
+   public:
+    void insert(std::byte const* begin,
+                std::byte const* end,
+                ox::detail::Widget_arena_state* owner)
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        blocks_.insert({begin, {end, owner}});
+        count_.store(blocks_.size());
+    }
+
+    void erase(std::byte const* begin)
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        blocks_.erase(begin);
+        count_.store(blocks_.size());
+    }
+
+    /// Return the arena holding \p p, or nullptr if from the heap.
+    auto find(void const* p) const -> ox::detail::Widget_arena_state*
+    {
+        if (count_.load() == 0uL)
+            return nullptr;
+        auto const* const address = static_cast<std::byte const*>(p);
+        auto const lock           = std::scoped_lock{mtx_};
+        auto at                   = blocks_.upper_bound(address);
+        if (at == std::begin(blocks_))
+            return nullptr;
+        auto const& [end, owner] = std::prev(at)->second;
+        return std::less<>{}(address, end) ? owner : nullptr;
+    }
+
+   private:
+    struct Block {
+        std::byte const* end;
+        ox::detail::Widget_arena_state* owner;
+    };
+
+    mutable std::mutex mtx_;
+    std::map<std::byte const*, Block, std::less<>> blocks_;
+    std::atomic<std::size_t> count_ = 0uL;
+};
+
+/// Never destroyed, Widgets and arenas can outlive static destruction.
+auto block_map() -> Block_map&
+{
+    static auto& map = *new Block_map;
+    return map;
+}
+
+}  // namespace
+
+namespace ox::detail {
+
+/// Blocks and free lists of a Widget_arena, outlives it until all are freed.
+class Widget_arena_state {
+   public:
+    explicit Widget_arena_state(std::size_t block_size)
+        : block_size_{block_size}
+    {}
+
+    Widget_arena_state(Widget_arena_state const&) = delete;
+    auto operator=(Widget_arena_state const&) -> Widget_arena_state& = delete;
+
+    ~Widget_arena_state()
+    {
+        for (auto const& block : blocks_)
+            block_map().erase(block.get());
+    }
+
+   public:
+    /// Return \p size bytes, from a free list if one of that size is held.
+    auto allocate(std::size_t size) -> void*
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        ++live_;
+        if (auto& head = free_lists_[size]; head != nullptr) {
+            auto* const node = head;
+            head             = node->next;
+            return node;
+        }
+        if (static_cast<std::size_t>(end_ - cursor_) < size) {
+            auto const bytes = size > block_size_ ? size : block_size_;
+            blocks_.push_back(std::make_unique<std::byte[]>(bytes));
+            reserved_ += bytes;
+            cursor_ = blocks_.back().get();
+            end_    = cursor_ + bytes;
+            block_map().insert(cursor_, end_, this);
+        }
+        return std::exchange(cursor_, cursor_ + size);
+    }
+
+    /// Put \p p on the free list for \p size.
+    /** Returns true if *this is no longer needed and should be deleted. */
+    auto deallocate(void* p, std::size_t size) -> bool
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        auto& head      = free_lists_[size];
+        head            = ::new (p) Free_node{head};
+        --live_;
+        return is_released_ && live_ == 0uL;
+    }
+
+    /// Forget \p p, its memory is not reused until the blocks are released.
+    /** For allocations freed without their size, see deallocate(). Returns
+     *  true if *this is no longer needed and should be deleted. */
+    auto forget(void*) -> bool
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        --live_;
+        return is_released_ && live_ == 0uL;
+    }
+
+    /// The owning Widget_arena was destroyed.
+    /** Returns true if *this is no longer needed and should be deleted. */
+    auto release() -> bool
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        is_released_    = true;
+        return live_ == 0uL;
+    }
+
+    auto live_count() const -> std::size_t
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        return live_;
+    }
+
+    auto reserved_bytes() const -> std::size_t
+    {
+        auto const lock = std::scoped_lock{mtx_};
+        return reserved_;
+    }
+
+   private:
+    struct Free_node {
+        Free_node* next;
+    };
+
+    mutable std::mutex mtx_;
+    std::size_t const block_size_;
+    std::vector<std::unique_ptr<std::byte[]>> blocks_;
+    std::byte* cursor_ = nullptr;
+    std::byte* end_    = nullptr;
+    std::unordered_map<std::size_t, Free_node*> free_lists_;
+    std::size_t live_     = 0uL;
+    std::size_t reserved_ = 0uL;
+    bool is_released_     = false;
+};
+
+}  // namespace ox::detail
+
+namespace {
+
+/// Arena of the innermost Widget_arena::Scope on this thread.
+thread_local ox::detail::Widget_arena_state* current_arena = nullptr;
+
+}  // namespace
+
+namespace ox {
+
+Widget_arena::Widget_arena(std::size_t block_size)
+    : state_{new detail::Widget_arena_state{aligned(block_size)}}
+{}
+
+Widget_arena::~Widget_arena()
+{
+    if (state_->release())
+        delete state_;
+}
+
+Widget_arena::Scope::Scope(Widget_arena& arena)
+    : previous_{std::exchange(current_arena, arena.state_)}
+{}
+
+Widget_arena::Scope::~Scope() { current_arena = previous_; }
+
+auto Widget_arena::live_count() const -> std::size_t
+{
+    return state_->live_count();
+}
+
+auto Widget_arena::reserved_bytes() const -> std::size_t
+{
+    return state_->reserved_bytes();
+}
+
+namespace detail {
+
+auto allocate_widget(std::size_t size) -> void*
+{
+    auto* const arena = current_arena;
+    return arena == nullptr ? ::operator new(size)
+                            : arena->allocate(aligned(size));
+}
+
+void deallocate_widget(void* p, std::size_t size) noexcept
+{
+    if (p == nullptr)
+        return;
+    auto* const arena = block_map().find(p);
+    if (arena == nullptr)
+        ::operator delete(p);
+    else if (arena->deallocate(p, aligned(size)))
+        delete arena;
+}
+
+void deallocate_widget(void* p) noexcept
+{
+    if (p == nullptr)
+        return;
+    auto* const arena = block_map().find(p);
+    if (arena == nullptr)
+        ::operator delete(p);
+    else if (arena->forget(p))
+        delete arena;
+}
+
+}  // namespace detail
+}  // namespace ox
@@ -0,0 +1,217 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include <termox/system/channel.hpp>
+#include <termox/system/detail/event_engine.hpp>
+#include <termox/system/detail/focus.hpp>
+#include <termox/system/event.hpp>
+#include <termox/system/key.hpp>
+#include <termox/system/mouse.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/array.hpp>
+#include <termox/widget/layouts/horizontal.hpp>
+#include <termox/widget/layouts/vertical.hpp>
+#include <termox/widget/widget.hpp>
+#include <termox/widget/widgets/button.hpp>
+#include <termox/widget/widgets/checkbox.hpp>
+#include <termox/widget/widgets/label.hpp>
+#include <termox/widget/widgets/textbox.hpp>
+
+// Steady State Allocations - After warm up, each frame of input, dispatch,
+// paint and flush must not allocate. Runs headless, the terminal is never
+// initialized. Global operator new is replaced to count allocations made while
+// frames are being measured. Returns non-zero if any screen allocates.
+
+namespace {
+
+auto is_counting = std::atomic<bool>{false};
+auto allocations = std::atomic<std::size_t>{0uL};
+
+auto counted_malloc(std::size_t size) -> void*
+{
+    if (is_counting.load(std::memory_order_relaxed))
+        allocations.fetch_add(1uL, std::memory_order_relaxed);
+    if (auto* const p = std::malloc(size == 0uL ? 1uL : size))
+        return p;
+    throw std::bad_alloc{};
+}
+
+auto counted_aligned_alloc(std::size_t size, std::align_val_t align) -> void*
+{
+    if (is_counting.load(std::memory_order_relaxed))
+        allocations.fetch_add(1uL, std::memory_order_relaxed);
+    auto const a = static_cast<std::size_t>(align);
+    if (auto* const p = std::aligned_alloc(a, (size + a - 1uL) / a * a))
+        return p;
+    throw std::bad_alloc{};
+}
+
+}  // namespace
+
+auto operator new(std::size_t size) -> void* { return counted_malloc(size); }
+
+auto operator new[](std::size_t size) -> void* { return counted_malloc(size); }
+
+auto operator new(std::size_t size, std::align_val_t align) -> void*
+{
+    return counted_aligned_alloc(size, align);
+}
+
+auto operator new[](std::size_t size, std::align_val_t align) -> void*
+{
+    return counted_aligned_alloc(size, align);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete[](void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+namespace {
+using namespace ox;
+
+auto constexpr warm_up_frames  = 50;
+auto constexpr measured_frames = 200;
+
+/// Drive \p head through frames, each preceded by \p input.
+/** Returns true if no measured frame allocated. */
+auto steady_state(std::string const& name,
+                  Widget& head,
+                  std::function<void()> const& input) -> bool
+{
+    System::set_head(&head);
+    head.enable();
+    System::post_event(Resize_event{head, Area{80uL, 24uL}});
+    detail::Focus::set(head);
+
+    auto& engine = System::event_engine();
+    for (auto i = 0; i < warm_up_frames; ++i) {
+        input();
+        engine.process();
+    }
+
+    allocations = 0uL;
+    is_counting = true;
+    for (auto i = 0; i < measured_frames; ++i) {
+        input();
+        engine.process();
+    }
+    is_counting = false;
+
+    // Send the Focus_out and Disable events before head is destroyed.
+    detail::Focus::clear();
+    System::set_head(nullptr);
+    engine.process();
+    auto const count = allocations.load();
+    std::cout << (count == 0uL ? "PASS " : "FAIL ") << name << ": " << count
+              << " allocations in " << measured_frames << " frames\n";
+    return count == 0uL;
+}
+
+auto mouse_press(Widget& w) -> Mouse_press_event
+{
+    auto m   = Mouse{};
+    m.global = w.inner_top_left();
+    m.button = Mouse::Button::Left;
+    return Mouse_press_event{w, m};
+}
+
+/// Wall of Checkboxes, as in checkbox.test.cpp.
+struct Wall : layout::Vertical<> {
+    using Checkboxes = Array<
+        layout::Horizontal<Array<layout::Vertical<Checkbox1>, 20>>,
+        40>;
+
+    Checkboxes& boxes = make_child<Checkboxes>();
+    HLabel& status    = make_child<HLabel>(Glyph_string{L"Status"});
+};
+
+auto checkbox_wall() -> bool
+{
+    auto wall = Wall{};
+    auto& box = wall.boxes.get_children()[7].get_children()[3];
+    return steady_state("checkbox wall, mouse toggles a box", wall,
+                        [&box] { System::post_event(mouse_press(box)); });
+}
+
+auto textbox_cursor() -> bool
+{
+    auto box   = Textbox{std::string(1'000uL, 'x')};
+    auto right = true;
+    return steady_state("textbox, arrow keys move the cursor", box, [&] {
+        auto const key = right ? Key::Arrow_right : Key::Arrow_left;
+        System::post_event(Key_press_event{box, key});
+        right = !right;
+    });
+}
+
+/// Labels and Buttons, everything is repainted each frame.
+struct Form : layout::Vertical<> {
+    HLabel& title   = make_child<HLabel>(Glyph_string{L"Settings"});
+    Button& ok      = make_child<Button>(Glyph_string{L"OK"});
+    Button& cancel  = make_child<Button>(Glyph_string{L"Cancel"});
+    HLabel& footer  = make_child<HLabel>(Glyph_string{L"Footer"});
+};
+
+auto form_repaint() -> bool
+{
+    auto form = Form{};
+    return steady_state("form, button press and full repaint", form, [&form] {
+        System::post_event(mouse_press(form.ok));
+        form.for_each_descendant([](Widget& w) { w.update(); });
+    });
+}
+
+/// Values sent through a Channel each frame, as from a worker thread.
+struct Ticker : Widget {
+    int last = 0;
+
+    Channel<int> values{"ticker", 16uL, Overflow::Drop_oldest, [this](int x) {
+                            last = x;
+                            this->update();
+                        }};
+};
+
+auto channel_drain() -> bool
+{
+    auto ticker = Ticker{};
+    auto next   = 0;
+    return steady_state("channel, values drained each frame", ticker, [&] {
+        for (auto i = 0; i < 4; ++i)
+            ticker.values.send(++next);
+    });
+}
+
+}  // namespace
+
+int main()
+{
+    auto passed = true;
+    passed      = checkbox_wall() && passed;
+    passed      = textbox_cursor() && passed;
+    passed      = form_repaint() && passed;
+    passed      = channel_drain() && passed;
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
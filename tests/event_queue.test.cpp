@@ -0,0 +1,116 @@
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#include <termox/painter/detail/is_paintable.hpp>
+#include <termox/system/detail/event_engine.hpp>
+#include <termox/system/event.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/layouts/vertical.hpp>
+#include <termox/widget/widget.hpp>
+
+// Event Queue - Events left queued when a frame runs over its budget must not
+// be sent once their receiver is destroyed, and Custom_events of any capture
+// size are copied and sent. Runs headless, the terminal is never initialized.
+// Returns non-zero if any scenario fails.
+
+namespace {
+using namespace ox;
+
+/// Counts Timer_events, always constructed in the same storage.
+/** Stale Events addressed to a destroyed Animated would be received by the
+ *  next Animated, as they would by any Widget allocated at a reused address. */
+struct Animated : Widget {
+    int timer_events = 0;
+
+    auto timer_event() -> bool override
+    {
+        ++timer_events;
+        return Widget::timer_event();
+    }
+
+    static auto operator new(std::size_t size) -> void*
+    {
+        if (size > sizeof(slot))
+            throw std::bad_alloc{};
+        return &slot;
+    }
+
+    static void operator delete(void*, std::size_t) noexcept {}
+
+    static std::aligned_storage_t<sizeof(Widget) * 2uL, alignof(Widget)> slot;
+};
+
+std::aligned_storage_t<sizeof(Widget) * 2uL, alignof(Widget)> Animated::slot;
+
+auto report(char const* name, bool passed) -> bool
+{
+    std::cout << (passed ? "PASS " : "FAIL ") << name << '\n';
+    return passed;
+}
+
+/// Delete an animated Widget in a frame that leaves its Timer_event queued.
+auto delete_over_budget() -> bool
+{
+    auto& engine      = System::event_engine();
+    auto const budget = engine.frame_budget();
+    engine.set_frame_budget(std::chrono::microseconds{0});
+
+    auto head = layout::Vertical<>{};
+    System::set_head(&head);
+    head.enable();
+    auto* const animated = &head.append_child(std::make_unique<Animated>());
+    System::post_event(Resize_event{head, Area{80uL, 24uL}});
+    engine.process();
+
+    // The Custom_event spends the budget, the Timer_event is left queued
+    // while animated is removed and then destroyed at the end of the frame.
+    System::post_event(Custom_event{
+        [&head, animated] { head.remove_and_delete_child(animated); }});
+    System::post_event(Timer_event{*animated});
+    engine.process();
+
+    auto& next = head.append_child(std::make_unique<Animated>());
+    engine.process();
+    engine.process();
+    auto const passed = std::addressof(next) == animated &&
+                        detail::is_paintable(next) && next.timer_events == 0;
+
+    System::set_head(nullptr);
+    engine.process();
+    engine.set_frame_budget(budget);
+    return report("animated Widget deleted over budget", passed);
+}
+
+/// A Custom_event with a capture larger than its in place storage.
+auto large_custom_event() -> bool
+{
+    auto received    = std::string{};
+    auto const text  = std::string(64uL, 'x');
+    auto const words = std::array<void*, 8>{};
+    auto const e     = Custom_event{[&received, text, words] {
+        received += text.substr(0uL, words.size());
+    }};
+    auto copy = e;
+    System::send_event(std::move(copy));
+    System::post_event(e);
+    System::event_engine().process();
+    return report("Custom_event with a large capture, copied and sent",
+                  received == std::string(16uL, 'x'));
+}
+
+}  // namespace
+
+int main()
+{
+    auto passed = true;
+    passed      = delete_over_budget() && passed;
+    passed      = large_custom_event() && passed;
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
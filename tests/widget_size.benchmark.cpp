@@ -0,0 +1,54 @@
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <termox/widget/border.hpp>
+#include <termox/widget/cursor.hpp>
+#include <termox/widget/size_policy.hpp>
+#include <termox/widget/widget.hpp>
+#include <termox/widget/widgets/button.hpp>
+#include <termox/widget/widgets/checkbox.hpp>
+#include <termox/widget/widgets/label.hpp>
+
+// Reports the memory footprint of Widget and of commonly used Widgets.
+// Does not initialize the terminal, the numbers are from sizeof only, heap
+// allocations made on first connect or install_event_filter are not counted.
+// Fails to compile if a footprint grows past its upper bound on a 64 bit
+// target.
+
+namespace {
+
+auto constexpr is_64_bit = sizeof(void*) == 8uL;
+
+static_assert(!is_64_bit || sizeof(ox::Widget) <= 800uL);
+static_assert(!is_64_bit || sizeof(ox::Border) <= 72uL);
+static_assert(!is_64_bit || sizeof(ox::Cursor) <= 32uL);
+static_assert(!is_64_bit || sizeof(ox::Size_policy) <= 56uL);
+static_assert(!is_64_bit || sizeof(ox::Widget::Event_filters_t) <= 24uL);
+static_assert(!is_64_bit || sizeof(ox::Checkbox1) <= 1'104uL);
+static_assert(!is_64_bit || sizeof(ox::HLabel) <= 864uL);
+static_assert(!is_64_bit || sizeof(ox::Button) <= 936uL);
+
+void report(std::string const& name, std::size_t bytes)
+{
+    std::cout << std::left << std::setw(24) << name << std::right
+              << std::setw(8) << bytes << " bytes\n";
+}
+
+}  // namespace
+
+int main()
+{
+    report("Widget", sizeof(ox::Widget));
+    report("  Border", sizeof(ox::Border));
+    report("  Cursor", sizeof(ox::Cursor));
+    report("  Size_policy", sizeof(ox::Size_policy));
+    report("  Event_filters_t", sizeof(ox::Widget::Event_filters_t));
+    report("Checkbox1", sizeof(ox::Checkbox1));
+    report("HLabel", sizeof(ox::HLabel));
+    report("Button", sizeof(ox::Button));
+
+    // The checkbox.test.cpp wall, not counting its layouts.
+    report("800 x Checkbox1", 800 * sizeof(ox::Checkbox1));
+}